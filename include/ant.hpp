@@ -10,11 +10,19 @@
 
 class World;
 class TextureCache;
+class LabelBatch;
 
 class Ant {
  public:
   static constexpr float MAX_VELOCITY = 30.0f;
   static constexpr int ANT_LIVES = 10;
+  static constexpr float TEXTURE_WIDTH = 16.0F;
+  static constexpr float TEXTURE_HEIGHT = TEXTURE_WIDTH;
+  static constexpr float FONT_SIZE = 10.0F;
+  static constexpr float FONT_SPACING = 1.0F;
+
+  // How much of an ant to draw, picked by the caller from the current zoom
+  typedef enum Detail { DOT = 0, BODY, FULL } Detail;
 
   Ant(World& world, const Genome& genome);
   Ant(const nlohmann::json& json, World& world);
@@ -27,7 +35,12 @@ class Ant {
 
   ~Ant();
 
+  // sense(), think() and move() in one go
   auto update(float time) -> void;
+  // Spends energy for the last step, dying when it runs out, and reads the surroundings
+  auto sense(float time) -> void;
+  auto think() -> void;
+  auto move(float time) -> void;
 
   [[nodiscard]] auto get_direction() const -> float;
 
@@ -62,7 +75,10 @@ class Ant {
   auto set_velocity(const Vector2 velocity) -> void;
   auto get_velocity() const -> const Vector2&;
 
-  auto get_genome() const -> Genome;
+  auto get_genome() const -> const Genome&;
+  [[nodiscard]] auto get_brain() const -> const Brain&;
+  // Everything its genome and brain own
+  [[nodiscard]] auto memory_usage() const -> Util::MemoryUsage;
 
   auto to_json() const -> nlohmann::json;
 
@@ -70,20 +86,17 @@ class Ant {
   auto set_texture_index(size_t index) -> void;
 
   // Drawing methods
-  auto draw(TextureCache& texture_cache) const -> void;
+  // Labels are queued on labels and drawn when the caller flushes it
+  auto draw(TextureCache& texture_cache, LabelBatch& labels, Detail detail = FULL) const -> void;
 
  protected:
 
   // Drawing constants
   static constexpr float LINE_THICKNESS = 2.0F;
-  static constexpr float FONT_SIZE = 10.0F;
-  static constexpr float FONT_SPACING = 1.0F;
   auto create_ant() -> Ant;
 
   const float STARTING_ENERGY = 1000.0F;
   const float SEDINTARY_ENERGY_PER_SECOND = 1.0F;
-  static constexpr float TEXTURE_WIDTH = 16.0F;
-  static constexpr float TEXTURE_HEIGHT = TEXTURE_WIDTH;
   static const Rectangle BOUNDS;
   static constexpr float RADIUS = TEXTURE_HEIGHT / 2.0;  // Half of 16x16 texture (proper circle radius)
   std::reference_wrapper<World> _world;
@@ -108,10 +121,12 @@ class Ant {
 
   // Drawing helper methods
   auto draw_body(TextureCache& texture_cache) const -> void;
-  auto draw_energy() const -> void;
-  auto draw_coordinates() const -> void;
+  auto draw_dot() const -> void;
+  auto draw_energy(const Rectangle& textRect) const -> void;
+  auto draw_coordinates(LabelBatch& labels) const -> void;
   auto draw_direction() const -> void;
   auto draw_bounding() const -> void;
-  [[nodiscard]] auto get_coordinates_rect() const -> Rectangle;
+  [[nodiscard]] auto get_coordinates_rect(LabelBatch& labels, std::string_view text) const
+      -> Rectangle;
   [[nodiscard]] auto get_rotation() const -> float;
 };
@@ -16,7 +16,15 @@ class Brain {
   Brain(const Brain& other) = default;
   auto operator=(const Brain& other) -> Brain&;
 
+  // sense() followed by think()
   auto update(float time, Vector2 position) -> Vector2;
+  // Re-reads the surroundings when due and passes any change on to the network inputs
+  auto sense(float time, Vector2 position) -> void;
+  // Velocity chosen by the network for the current inputs
+  auto think() -> Vector2;
+
+  [[nodiscard]] auto get_network() const -> const NeuralNetwork&;
+  [[nodiscard]] auto memory_usage() const -> Util::MemoryUsage;
 
  protected:
   auto update_surroundings(Vector2 position) -> void;
@@ -26,8 +34,6 @@ class Brain {
   Surroundings _surroundings;
   NeuralNetwork _neuralNetwork;
 
-  std::vector<Neuron::Value> _surroundings_encoded;
-
   float _last_update = 0.0F;
   const size_t TILES_SIZE = 10;
   const size_t TILES_COUNT = 10;
@@ -4,6 +4,8 @@
 #include <iostream>
 #include <numeric>
 
+#include "util/memory_usage.hpp"
+
 namespace Containers {
 template <typename T>
 concept Summable = requires(T a, T b) {
@@ -27,6 +29,11 @@ class CircularStats {
   auto set_max_data_points(size_t maxDataPoints) -> void;
   auto get_max_data_points() -> size_t;
   auto clear() -> void;
+  // Approximate: the deque's blocks and map are implementation-defined, so this counts the
+  // values held as one allocation
+  [[nodiscard]] auto memory_usage() const -> Util::MemoryUsage {
+    return {_rawData.size() * sizeof(T), _rawData.empty() ? 0U : 1U};
+  }
 
  protected:
   auto resize() -> void;
@@ -0,0 +1,163 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "util/memory_usage.hpp"
+
+namespace Containers {
+
+/*  Unbounded time series kept at a bounded size by summarizing it at power-of-two resolutions.
+
+    Level k holds the latest CAPACITY buckets of 2^k consecutive samples each, as their min,
+    max and sum, so recent history is exact and old history survives as coarser envelopes.
+    A bucket completed on level k is folded into level k + 1, which makes push() O(1)
+    amortized. sample() reads from the finest level that covers the asked range in at most
+    max_points buckets, so its cost does not grow with the length of the history. Memory is
+    LEVELS * CAPACITY buckets, allocated by the first push().
+*/
+template <std::floating_point T, size_t CAPACITY = 512, size_t LEVELS = 32>
+  requires(CAPACITY >= 2 && (CAPACITY & (CAPACITY - 1)) == 0 && LEVELS > 0 && LEVELS < 64)
+class MinMaxPyramid {
+ public:
+  // Summary of the samples [first, first + count); all doubles so plots can stride over them
+  struct Point {
+    double first = 0.0;
+    double min = 0.0;
+    double max = 0.0;
+    double mean = 0.0;
+    double count = 0.0;
+  };
+
+  auto push(T value) -> void;
+
+  // Replaces points with the summary of the samples [first, last) in at most about
+  // max_points buckets, plus at most one partial bucket per level for the newest samples
+  auto sample(uint64_t first, uint64_t last, size_t max_points, std::vector<Point>& points) const
+      -> void;
+
+  [[nodiscard]] auto size() const -> uint64_t { return _size; }
+  [[nodiscard]] auto empty() const -> bool { return _size == 0; }
+  // Oldest sample each level still covers, so level 0 is the start of the exact history
+  [[nodiscard]] auto get_oldest(size_t level) const -> uint64_t;
+  [[nodiscard]] auto memory_usage() const -> Util::MemoryUsage {
+    return Util::MemoryUsage{}.add(_buckets);
+  }
+  auto clear() -> void;
+
+ protected:
+  struct Bucket {
+    T min;
+    T max;
+    double sum;
+  };
+
+  static auto merge(Bucket& into, const Bucket& from) -> void {
+    into.min = std::min(into.min, from.min);
+    into.max = std::max(into.max, from.max);
+    into.sum += from.sum;
+  }
+
+  // Buckets completed on level
+  [[nodiscard]] auto completed(size_t level) const -> uint64_t { return _size >> level; }
+  [[nodiscard]] auto bucket(size_t level, uint64_t index) const -> const Bucket& {
+    return _buckets[level * CAPACITY + (index & (CAPACITY - 1))];
+  }
+  auto append(size_t level, uint64_t index, const Bucket& value, std::vector<Point>& points) const
+      -> void;
+
+  uint64_t _size = 0;
+  std::vector<Bucket> _buckets;
+  // First half of the bucket being built on each level, waiting for its second half
+  std::array<Bucket, LEVELS> _pending{};
+};
+
+template <std::floating_point T, size_t CAPACITY, size_t LEVELS>
+  requires(CAPACITY >= 2 && (CAPACITY & (CAPACITY - 1)) == 0 && LEVELS > 0 && LEVELS < 64)
+auto MinMaxPyramid<T, CAPACITY, LEVELS>::push(T value) -> void {
+  if (_buckets.empty()) {
+    _buckets.resize(LEVELS * CAPACITY);
+  }
+
+  ++_size;
+  Bucket done{value, value, static_cast<double>(value)};
+  for (size_t level = 0; level < LEVELS; ++level) {
+    const uint64_t index = completed(level) - 1;
+    _buckets[level * CAPACITY + (index & (CAPACITY - 1))] = done;
+    if (level + 1 == LEVELS) {
+      break;
+    }
+    // An even bucket is the first half of the next level's; an odd one completes it
+    if ((index & 1) == 0) {
+      _pending[level + 1] = done;
+      break;
+    }
+    merge(_pending[level + 1], done);
+    done = _pending[level + 1];
+  }
+}
+
+template <std::floating_point T, size_t CAPACITY, size_t LEVELS>
+  requires(CAPACITY >= 2 && (CAPACITY & (CAPACITY - 1)) == 0 && LEVELS > 0 && LEVELS < 64)
+auto MinMaxPyramid<T, CAPACITY, LEVELS>::get_oldest(size_t level) const -> uint64_t {
+  const uint64_t buckets = completed(level);
+  return (buckets > CAPACITY ? buckets - CAPACITY : 0) << level;
+}
+
+template <std::floating_point T, size_t CAPACITY, size_t LEVELS>
+  requires(CAPACITY >= 2 && (CAPACITY & (CAPACITY - 1)) == 0 && LEVELS > 0 && LEVELS < 64)
+auto MinMaxPyramid<T, CAPACITY, LEVELS>::append(size_t level, uint64_t index, const Bucket& value,
+                                                std::vector<Point>& points) const -> void {
+  const uint64_t width = uint64_t{1} << level;
+  const double count = static_cast<double>(width);
+  points.push_back({static_cast<double>(index * width), static_cast<double>(value.min),
+                    static_cast<double>(value.max), value.sum / count, count});
+}
+
+template <std::floating_point T, size_t CAPACITY, size_t LEVELS>
+  requires(CAPACITY >= 2 && (CAPACITY & (CAPACITY - 1)) == 0 && LEVELS > 0 && LEVELS < 64)
+auto MinMaxPyramid<T, CAPACITY, LEVELS>::sample(uint64_t first, uint64_t last, size_t max_points,
+                                                std::vector<Point>& points) const -> void {
+  points.clear();
+  last = std::min(last, _size);
+  if (first >= last) {
+    return;
+  }
+
+  // Finest level that spans the range in max_points buckets and still reaches back to first
+  size_t level = 0;
+  const uint64_t span = last - first;
+  while (level + 1 < LEVELS &&
+         ((span >> level) > std::max<size_t>(max_points, 1) || get_oldest(level) > first)) {
+    ++level;
+  }
+
+  uint64_t index = std::max(first, get_oldest(level)) >> level;
+  const uint64_t end = std::min(completed(level), (last + (uint64_t{1} << level) - 1) >> level);
+  for (; index < end; ++index) {
+    append(level, index, bucket(level, index), points);
+  }
+
+  // Samples newer than the level's last complete bucket come from the finer levels, which
+  // need at most one bucket each to reach the end
+  uint64_t covered = end << level;
+  while (level > 0 && covered < last) {
+    --level;
+    for (index = covered >> level; index < completed(level) && (index << level) < last;
+         ++index) {
+      append(level, index, bucket(level, index), points);
+      covered = (index + 1) << level;
+    }
+  }
+}
+
+template <std::floating_point T, size_t CAPACITY, size_t LEVELS>
+  requires(CAPACITY >= 2 && (CAPACITY & (CAPACITY - 1)) == 0 && LEVELS > 0 && LEVELS < 64)
+auto MinMaxPyramid<T, CAPACITY, LEVELS>::clear() -> void {
+  _size = 0;
+}
+
+}  // namespace Containers
@@ -0,0 +1,147 @@
+#pragma once
+#include <raylib.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "util/memory_usage.hpp"
+
+namespace Containers {
+
+/*  SpatialGrid buckets item indices into uniform square cells covering a bounding rectangle.
+
+    The grid is rebuilt wholesale with build() rather than updated item by item. Items are
+    counting-sorted by cell into one flat array, so a rebuild reuses the existing buffers and
+    a query only touches the cells that overlap the query rectangle.
+
+    Positions outside the bounds are clamped into the nearest edge cell, so every item is
+    always reachable. Queries are conservative: callers still perform their exact test.
+    A visitor that returns bool stops the query as soon as it returns false.
+*/
+class SpatialGrid {
+ public:
+  typedef uint32_t Index;
+
+  SpatialGrid() = default;
+  SpatialGrid(const Rectangle& bounds, float cellSize) { set_bounds(bounds, cellSize); }
+
+  auto set_bounds(const Rectangle& bounds, float cellSize) -> void {
+    _bounds = bounds;
+    _cellSize = std::max(cellSize, 1.0F);
+    _columns = std::max<size_t>(1, static_cast<size_t>(std::ceil(bounds.width / _cellSize)));
+    _rows = std::max<size_t>(1, static_cast<size_t>(std::ceil(bounds.height / _cellSize)));
+    _cellStart.assign(_columns * _rows + 1, 0);
+    _items.clear();
+  }
+
+  // position(i) must return the Vector2 of item i for i in [0, count)
+  template <typename PositionFn>
+  auto build(size_t count, PositionFn&& position) -> void {
+    _itemCell.resize(count);
+    _items.resize(count);
+    std::fill(_cellStart.begin(), _cellStart.end(), 0);
+
+    for (size_t i = 0; i < count; ++i) {
+      _itemCell[i] = static_cast<Index>(cell_index(position(i)));
+      ++_cellStart[_itemCell[i] + 1];
+    }
+    for (size_t cell = 1; cell < _cellStart.size(); ++cell) {
+      _cellStart[cell] += _cellStart[cell - 1];
+    }
+
+    // _cellStart[cell] is used as the write cursor and ends up at the start of cell + 1,
+    // so shift it back afterwards instead of keeping a second cursor array
+    for (size_t i = 0; i < count; ++i) {
+      _items[_cellStart[_itemCell[i]]++] = static_cast<Index>(i);
+    }
+    for (size_t cell = _cellStart.size() - 1; cell > 0; --cell) {
+      _cellStart[cell] = _cellStart[cell - 1];
+    }
+    _cellStart[0] = 0;
+  }
+
+  // visit(index) is called for every item whose cell overlaps rect
+  template <typename Visitor>
+  auto query(const Rectangle& rect, Visitor&& visit) const -> void {
+    if (_items.empty()) {
+      return;
+    }
+    const size_t minColumn = column_of(rect.x);
+    const size_t maxColumn = column_of(rect.x + rect.width);
+    const size_t minRow = row_of(rect.y);
+    const size_t maxRow = row_of(rect.y + rect.height);
+
+    for (size_t row = minRow; row <= maxRow; ++row) {
+      // cells of one row are contiguous, so the whole column span is a single item range
+      const size_t first = _cellStart[row * _columns + minColumn];
+      const size_t last = _cellStart[row * _columns + maxColumn + 1];
+      if (!visit_range(first, last, visit)) {
+        return;
+      }
+    }
+  }
+
+  // visit(index) is called for every item bucketed into cell, for cell in [0, get_cell_count())
+  template <typename Visitor>
+  auto query_cell(size_t cell, Visitor&& visit) const -> void {
+    visit_range(_cellStart[cell], _cellStart[cell + 1], visit);
+  }
+
+  [[nodiscard]] auto size() const -> size_t { return _items.size(); }
+  [[nodiscard]] auto empty() const -> bool { return _items.empty(); }
+  [[nodiscard]] auto get_cell_size() const -> float { return _cellSize; }
+  [[nodiscard]] auto get_cell_count() const -> size_t { return _columns * _rows; }
+  [[nodiscard]] auto get_bounds() const -> const Rectangle& { return _bounds; }
+  [[nodiscard]] auto memory_usage() const -> Util::MemoryUsage {
+    return Util::MemoryUsage{}.add(_cellStart).add(_items).add(_itemCell);
+  }
+
+ protected:
+  // Returns false when the visitor asked to stop
+  template <typename Visitor>
+  auto visit_range(size_t first, size_t last, Visitor& visit) const -> bool {
+    for (size_t item = first; item < last; ++item) {
+      if constexpr (std::is_same_v<std::invoke_result_t<Visitor&, size_t>, bool>) {
+        if (!visit(static_cast<size_t>(_items[item]))) {
+          return false;
+        }
+      } else {
+        visit(static_cast<size_t>(_items[item]));
+      }
+    }
+    return true;
+  }
+
+  auto column_of(float x) const -> size_t {
+    const float column = std::floor((x - _bounds.x) / _cellSize);
+    if (!(column > 0.0F)) {
+      return 0;  // also catches NaN
+    }
+    return std::min(static_cast<size_t>(column), _columns - 1);
+  }
+
+  auto row_of(float y) const -> size_t {
+    const float row = std::floor((y - _bounds.y) / _cellSize);
+    if (!(row > 0.0F)) {
+      return 0;
+    }
+    return std::min(static_cast<size_t>(row), _rows - 1);
+  }
+
+  auto cell_index(Vector2 position) const -> size_t {
+    return row_of(position.y) * _columns + column_of(position.x);
+  }
+
+  Rectangle _bounds = {0.0F, 0.0F, 0.0F, 0.0F};
+  float _cellSize = 1.0F;
+  size_t _columns = 1;
+  size_t _rows = 1;
+  std::vector<Index> _cellStart = std::vector<Index>(2, 0);
+  std::vector<Index> _items;
+  std::vector<Index> _itemCell;
+};
+
+}  // namespace Containers
@@ -0,0 +1,75 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+
+namespace Containers {
+
+/*  Fixed-capacity single-producer single-consumer queue without locks.
+
+    One thread may push and one other thread may pop at the same time. Neither side ever
+    waits: push() fails when the ring is full and pop() when it is empty, so a slow consumer
+    costs the producer nothing but dropped items, which get_dropped() counts. The head and
+    tail live on separate cache lines so the two sides do not contend.
+*/
+template <typename T, size_t CAPACITY>
+  requires(CAPACITY > 0 && (CAPACITY & (CAPACITY - 1)) == 0 && std::is_copy_assignable_v<T>)
+class SpscRing {
+ public:
+  // Producer side; false, and the item dropped, when the ring is full
+  auto push(const T& item) -> bool {
+    const size_t tail = _tail.load(std::memory_order_relaxed);
+    if (tail - _head.load(std::memory_order_acquire) == CAPACITY) {
+      _dropped.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    _items[tail & (CAPACITY - 1)] = item;
+    _tail.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Consumer side
+  auto pop() -> std::optional<T> {
+    const size_t head = _head.load(std::memory_order_relaxed);
+    if (head == _tail.load(std::memory_order_acquire)) {
+      return std::nullopt;
+    }
+    T item = _items[head & (CAPACITY - 1)];
+    _head.store(head + 1, std::memory_order_release);
+    return item;
+  }
+
+  // Consumer side; calls visit(item) for everything queued, returning how many there were
+  template <typename Visitor>
+  auto drain(Visitor&& visit) -> size_t {
+    size_t count = 0;
+    while (auto item = pop()) {
+      visit(*item);
+      ++count;
+    }
+    return count;
+  }
+
+  // Approximate while the other side is active
+  [[nodiscard]] auto size() const -> size_t {
+    return _tail.load(std::memory_order_acquire) - _head.load(std::memory_order_acquire);
+  }
+  [[nodiscard]] auto empty() const -> bool { return size() == 0; }
+  [[nodiscard]] static constexpr auto capacity() -> size_t { return CAPACITY; }
+  [[nodiscard]] auto get_dropped() const -> uint64_t {
+    return _dropped.load(std::memory_order_relaxed);
+  }
+
+ protected:
+  static constexpr size_t CACHE_LINE = 64;
+
+  alignas(CACHE_LINE) std::atomic<size_t> _head{0};
+  alignas(CACHE_LINE) std::atomic<size_t> _tail{0};
+  alignas(CACHE_LINE) std::atomic<uint64_t> _dropped{0};
+  std::array<T, CAPACITY> _items{};
+};
+
+}  // namespace Containers
@@ -23,6 +23,7 @@ class Food {
   auto operator==(const Food& other) const -> bool;
 
   auto draw() const -> void;
+  auto draw_dot() const -> void;
   auto eat(Ant& ant) -> void;
 
   [[nodiscard]] auto get_position() const -> const Vector2&;
@@ -3,11 +3,14 @@
 #include <raylib.h>
 #include <raymath.h>
 
+#include <chrono>
 #include <expected>
 #include <input.hpp>
 #include <string>
 #include <texture_cache.hpp>
 #include <ui/renderer.hpp>
+#include <util/allocation_counter.hpp>
+#include <util/thread_pool_monitor.hpp>
 #include <world.hpp>
 
 class Game {
@@ -34,6 +37,8 @@ class Game {
   auto load_textures() -> void;
   auto initialize_raylib() -> void;
   auto no_render_run() -> void;
+  // Feeds one frame's timings and counts to the performance panel
+  auto publish_frame(UI::Menu::PerformancePanel::Frame& frame) -> void;
   const float DEFAULT_FPS = 60;
   Camera2D _camera;
   TextureCache _textureCache;
@@ -45,4 +50,12 @@ class Game {
   float _lastSpeedAdjustmentTime = 0.0f;
   bool _raylibInitialized = false;
   UI::Renderer _ui;
+  Util::ThreadPoolMonitor _threadPoolMonitor;
+  // Totals at the start of the current frame, for per-frame differences
+  std::chrono::steady_clock::time_point _frameStart;
+  Util::AllocationCounter::Counts _frameAllocations;
+  double _frameBusySeconds = 0.0;
+  // The performance panel's heap footprint is resampled this often
+  static constexpr double MEMORY_REPORT_SECONDS = 1.0;
+  std::chrono::steady_clock::time_point _lastMemoryReport;
 };
@@ -2,10 +2,14 @@
 
 #include <cmath>
 #include <nlohmann/json.hpp>
+#include <span>
+#include <vector>
 
 #include "neural_network.hpp"
 #include "neuron.hpp"
 #include "random_generator.hpp"
+#include "util/half.hpp"
+#include "util/memory_usage.hpp"
 
 class Genome {
  public:
@@ -18,8 +22,24 @@ class Genome {
   auto operator=(Genome&& other) noexcept -> Genome&;
   auto operator==(const Genome& other) const -> bool;
 
-  auto breed_with(const Genome& other) -> Genome;
+  // Leaves both parents as they are, compact or not; the crossover masks and the child's own
+  // generator are drawn from rng, so parents shared between callers are never written
+  auto breed_with(const Genome& other, RandomGenerator& rng) const -> Genome;
+  // Throws std::logic_error while the genome is compact
   auto get_network() const -> const NeuralNetwork&;
+  // Float copy of the network, widened from the packed weights when the genome is compact
+  auto to_network() const -> NeuralNetwork;
+
+  // Weights at rest: FP16 and BF16 pack every bias and weight into 16 bits and release the
+  // float layers until expand() widens them back; FP32 is the same as expand()
+  auto compact(Util::WeightFormat format) -> void;
+  auto expand() -> void;
+  auto is_compact() const -> bool;
+  auto get_weight_format() const -> Util::WeightFormat;
+  // Bytes taken by the biases and weights in the current format
+  auto get_weight_bytes() const -> size_t;
+  // Its network, or the packed weights and the empty network left while compact
+  auto memory_usage() const -> Util::MemoryUsage;
 
   auto mutate() -> void;
   auto randomize() -> void;
@@ -36,16 +56,38 @@ class Genome {
   auto to_json() const -> nlohmann::json;
 
  protected:
-  auto breed_network(NeuralNetwork& childNetwork) -> void;
-  auto breed_layer(const NeuralNetwork::Layer& parent, NeuralNetwork::Layer& childLayer) -> void;
-  auto breed_neuron(const Neuron& parentNeuron, Neuron& childNeuron) -> void;
+  // Crosses every neuron of childNetwork with the parent neuron that
+  // parent(layerIndex, neuronIndex, childNeuron) returns as its bias and weights
+  template <typename ParentNeuron>
+  static auto breed_network(ParentNeuron&& parent,
+                            NeuralNetwork& childNetwork,
+                            RandomGenerator& rng) -> void;
+  // Copies each parent weight into child where the matching bit of a random 64-bit mask is set
+  static auto crossover(std::span<const Neuron::Value> parent,
+                        std::span<Neuron::Value> child,
+                        RandomGenerator& rng) -> void;
 
-  auto mutate_layer(NeuralNetwork::Layer& layer);
-  auto mutate_neuron(Neuron& neuron);
-  auto should_mutate() -> bool;
+  // Parameters to pass over before the next mutation: geometric with p = _mutationRate, so
+  // mutate() draws one gap per mutated parameter instead of one uniform per parameter
+  auto mutation_gap() -> size_t;
   auto mutation_amount() -> double;
+  auto packed_network_json() const -> nlohmann::json;
+  auto load_packed_network(const nlohmann::json& json) -> void;
+
+  // Topology kept alongside the packed weights so expand() can rebuild the network
+  struct Shape {
+    size_t inputs = 0;
+    size_t hiddenLayers = 0;
+    size_t hiddenNeurons = 0;
+    size_t outputs = 0;
+
+    auto operator==(const Shape& other) const -> bool = default;
+  };
 
   NeuralNetwork _network;
+  Util::WeightFormat _weightFormat = Util::FP32;
+  Shape _packedShape;
+  std::vector<Util::Half> _packedWeights;  // NeuralNetwork::get_parameters order
   double _mutationRate = 0.1F;
   double _fitness = 0.0F;
   size_t _childrenCount = 0;
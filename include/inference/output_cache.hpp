@@ -0,0 +1,67 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "neuron.hpp"
+#include "util/memory_usage.hpp"
+
+namespace Inference {
+
+/*  OutputCache remembers a network's outputs for recently seen ternary input patterns.
+
+    A network is deterministic, so its outputs are a pure function of its weights and the
+    food/wall masks it was given. Ants mostly see an empty window or the same window as the
+    tick before, so a small direct-mapped table keyed by a hash of the masks skips most
+    forward passes. Each slot stores the full masks, so a hash collision is a miss rather
+    than a wrong answer.
+
+    The owner must clear() the cache whenever its weights change.
+*/
+class OutputCache {
+ public:
+  typedef uint64_t Mask;
+  static constexpr size_t SLOT_COUNT = 8;
+
+  struct Stats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+
+    [[nodiscard]] auto lookups() const -> uint64_t { return hits + misses; }
+    [[nodiscard]] auto hit_rate() const -> double {
+      return lookups() == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(lookups());
+    }
+    auto operator+=(const Stats& other) -> Stats& {
+      hits += other.hits;
+      misses += other.misses;
+      return *this;
+    }
+  };
+
+  // Cached outputs for the masks, or an empty span on a miss
+  auto find(std::span<const Mask> positive, std::span<const Mask> negative)
+      -> std::span<const Neuron::Value>;
+  auto insert(std::span<const Mask> positive,
+              std::span<const Mask> negative,
+              std::span<const Neuron::Value> outputs) -> void;
+  auto clear() -> void;
+
+  [[nodiscard]] auto get_stats() const -> const Stats&;
+  [[nodiscard]] auto memory_usage() const -> Util::MemoryUsage;
+
+ protected:
+  static auto hash(std::span<const Mask> positive, std::span<const Mask> negative) -> size_t;
+  auto matches(size_t slot, std::span<const Mask> positive, std::span<const Mask> negative) const
+      -> bool;
+
+  size_t _maskCount = 0;
+  size_t _outputCount = 0;
+  std::vector<Mask> _keys;  // per slot: _maskCount positive words then _maskCount negative
+  std::vector<Neuron::Value> _outputs;
+  std::array<bool, SLOT_COUNT> _valid{};
+  Stats _stats;
+};
+
+}  // namespace Inference
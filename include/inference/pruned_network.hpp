@@ -0,0 +1,110 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "inference/ternary_layer.hpp"
+#include "neuron.hpp"
+#include "util/memory_usage.hpp"
+
+namespace Inference {
+
+/*  BlockSparseLayer is a fully connected layer with its small weights pruned away.
+
+    Weights are stored input-major in blocks of BLOCK_SIZE neurons. For every input column and
+    block there is a bitmask of the neurons whose weight was kept, and only those weights are
+    stored, packed. Adding a column to a block of sums expands the packed weights into their
+    lanes (one expand-load with AVX-512, a walk over the mask bits otherwise), so no pruned
+    weight is ever read. Inputs whose weights were all pruned get no column: an index map sends
+    the others to their slot in the packed storage, and a live mask lets ternary bits skip them.
+
+    Sums are kept block by block, so a layer takes -1/0/+1 bitmasks like TernaryLayer, arbitrary
+    values, or single-column patches for inputs that changed (add_column).
+*/
+class BlockSparseLayer {
+ public:
+  typedef TernaryLayer::Mask Mask;
+  typedef uint16_t BlockMask;
+  static constexpr size_t BLOCK_SIZE = 16;
+  typedef uint16_t Slot;
+  static constexpr Slot NO_SLOT = UINT16_MAX;
+
+  // Keeps the neurons of layer listed in neurons and, of each, the weights with
+  // |w| >= threshold from the inputs listed in inputs; both lists give the new order. At most
+  // NO_SLOT inputs
+  auto build(std::span<const Neuron> layer,
+             std::span<const uint32_t> neurons,
+             std::span<const uint32_t> inputs,
+             Neuron::Value threshold) -> void;
+
+  // Writes bias + sum(positive columns) - sum(negative columns) for every neuron into out
+  auto pre_activate(std::span<const Mask> positive,
+                    std::span<const Mask> negative,
+                    std::span<Neuron::Value> out) const -> void;
+  // Writes bias + weights . inputs for arbitrary inputs, one column per non-zero input
+  auto pre_activate(std::span<const Neuron::Value> inputs, std::span<Neuron::Value> out) const
+      -> void;
+  // out += scale * (kept weights of every neuron for input)
+  auto add_column(size_t input, Neuron::Value scale, std::span<Neuron::Value> out) const -> void;
+
+  [[nodiscard]] auto get_input_count() const -> size_t;
+  [[nodiscard]] auto get_neuron_count() const -> size_t;
+  [[nodiscard]] auto get_weight_count() const -> size_t;
+  [[nodiscard]] auto memory_usage() const -> Util::MemoryUsage;
+
+ protected:
+  // lanes += scale * the block of weights kept for one column slot
+  auto add_block(Slot slot,
+                 size_t block,
+                 Neuron::Value scale,
+                 Neuron::Value* lanes) const -> void;
+  auto add_columns(std::span<const Mask> masks,
+                   size_t block,
+                   Neuron::Value scale,
+                   Neuron::Value* lanes) const -> void;
+
+  size_t _inputCount = 0;
+  size_t _neuronCount = 0;
+  size_t _blockCount = 0;
+  std::vector<Slot> _slots;             // column slot of each input, NO_SLOT when all were pruned
+  std::vector<Mask> _liveInputs;        // bit per input with a column
+  std::vector<BlockMask> _masks;        // _masks[slot * _blockCount + block]: kept neurons
+  std::vector<uint32_t> _offsets;       // where each of those blocks starts in _weights
+  std::vector<Neuron::Value> _weights;  // kept weights only, slot by slot and block by block
+  std::vector<Neuron::Value> _biases;   // padded to whole blocks
+};
+
+/*  The compact copy of a NeuralNetwork that pruned brains run instead of the dense one.
+
+    Weights below the threshold are dropped, and so is every hidden neuron left without a kept
+    weight into a live neuron of the next layer, since its activation can no longer reach the
+    outputs. Each layer keeps only its live neurons, reading the live neurons of the layer
+    before it, as a BlockSparseLayer. The first layer is exposed so pruned brains keep the
+    bitmask, incremental and cached paths; its sums cover the live first-layer neurons only.
+*/
+class PrunedNetwork {
+ public:
+  auto load(size_t inputs,
+            const std::vector<std::vector<Neuron>>& hidden,
+            const std::vector<Neuron>& output,
+            Neuron::Value threshold) -> void;
+
+  [[nodiscard]] auto get_first_layer() const -> const BlockSparseLayer&;
+  // Every layer after the first, starting from the live first-layer neurons' activations
+  auto propagate(std::span<const Neuron::Value> firstLayer, std::span<Neuron::Value> outputs)
+      -> void;
+
+  // Weights left after pruning, in every layer
+  [[nodiscard]] auto get_weight_count() const -> size_t;
+  // Layers and scratch buffers
+  [[nodiscard]] auto memory_usage() const -> Util::MemoryUsage;
+
+ protected:
+  BlockSparseLayer _first;
+  std::vector<BlockSparseLayer> _layers;  // the layers after the first
+  std::array<std::vector<Neuron::Value>, 2> _values;  // ping-pong scratch for hidden activations
+};
+
+}  // namespace Inference
@@ -0,0 +1,113 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "inference/ternary_layer.hpp"
+#include "neuron.hpp"
+#include "util/memory_usage.hpp"
+
+namespace Inference {
+
+/*  QuantizedLayer is a fully connected layer with int8 weights and a float scale per neuron.
+
+    Weights are scaled per row so the largest magnitude maps to 127. Activations (tanh
+    outputs and sensing values, both in [-1, 1]) are quantized to unsigned bytes as
+    round(x * 63) + 64, which keeps every pairwise product sum of pmaddubsw within int16.
+    The zero-point offset is removed afterwards with a precomputed per-row weight sum.
+
+    Rows are padded with zero weights to a multiple of 32 so the dot product kernel
+    (AVX-VNNI, AVX2 or scalar, chosen at compile time) never needs a tail loop.
+*/
+class QuantizedLayer {
+ public:
+  static constexpr float ACTIVATION_SCALE = 63.0F;
+  static constexpr int32_t ACTIVATION_ZERO = 64;
+  static constexpr size_t ROW_ALIGNMENT = 32;
+
+  auto load(std::span<const Neuron> neurons, size_t inputCount) -> void;
+
+  // Writes bias + dequantized dot product (the pre-activation) for every neuron into out
+  auto pre_activate(std::span<const uint8_t> inputs, std::span<Neuron::Value> out) const -> void;
+
+  static auto quantize(std::span<const Neuron::Value> values, std::span<uint8_t> out) -> void;
+  static auto padded_size(size_t count) -> size_t;
+
+  [[nodiscard]] auto get_input_count() const -> size_t;
+  [[nodiscard]] auto get_neuron_count() const -> size_t;
+  [[nodiscard]] auto get_weight_bytes() const -> size_t;
+  [[nodiscard]] auto memory_usage() const -> Util::MemoryUsage;
+
+ protected:
+  size_t _inputCount = 0;
+  size_t _rowSize = 0;  // _inputCount rounded up to ROW_ALIGNMENT
+  size_t _neuronCount = 0;
+  std::vector<int8_t> _weights;  // row-major, _rowSize per neuron
+  std::vector<float> _scales;    // per neuron: weight step / ACTIVATION_SCALE
+  std::vector<int32_t> _rowSums;
+  std::vector<float> _biases;
+};
+
+/*  QuantizedTernaryLayer is TernaryLayer with int8 weight columns and a float step per neuron.
+
+    Columns are quantized per neuron like QuantizedLayer rows, so a set bit adds one column of
+    small integers; the sums stay exact integers in float lanes until the step and bias are
+    applied. Pre-activations are ordinary scaled floats, so a caller patches them across a
+    few changed inputs with add_column exactly as with TernaryLayer.
+*/
+class QuantizedTernaryLayer {
+ public:
+  typedef TernaryLayer::Mask Mask;
+
+  auto build(std::span<const Neuron> neurons, size_t inputCount) -> void;
+
+  // Writes bias + step * (sum(positive columns) - sum(negative columns)) into out
+  auto pre_activate(std::span<const Mask> positive,
+                    std::span<const Mask> negative,
+                    std::span<Neuron::Value> out) const -> void;
+  // Writes bias + step * (columns . inputs) for arbitrary inputs
+  auto pre_activate(std::span<const Neuron::Value> inputs, std::span<Neuron::Value> out) const
+      -> void;
+  // out += scale * step * column for input
+  auto add_column(size_t input, Neuron::Value scale, std::span<Neuron::Value> out) const -> void;
+
+  [[nodiscard]] auto get_input_count() const -> size_t;
+  [[nodiscard]] auto get_neuron_count() const -> size_t;
+  [[nodiscard]] auto get_weight_bytes() const -> size_t;
+  [[nodiscard]] auto memory_usage() const -> Util::MemoryUsage;
+
+ protected:
+  size_t _inputCount = 0;
+  size_t _neuronCount = 0;
+  std::vector<int8_t> _columns;  // _columns[input * _neuronCount + neuron]
+  std::vector<float> _steps;     // per neuron: the weight one int8 unit stands for
+  std::vector<float> _biases;
+};
+
+/*  The int8 copy of a NeuralNetwork: its first layer as ternary columns, so INT8 brains keep
+    the bitmask, incremental and cached paths, then a QuantizedLayer per later layer.
+*/
+class QuantizedNetwork {
+ public:
+  auto load(size_t inputs,
+            const std::vector<std::vector<Neuron>>& hidden,
+            const std::vector<Neuron>& output) -> void;
+
+  [[nodiscard]] auto get_first_layer() const -> const QuantizedTernaryLayer&;
+  // Every layer after the first, starting from the first layer's activations
+  auto propagate(std::span<const Neuron::Value> firstLayer, std::span<Neuron::Value> outputs)
+      -> void;
+
+  [[nodiscard]] auto get_weight_bytes() const -> size_t;
+  // Layers and scratch buffers, which may hold more than get_weight_bytes()
+  [[nodiscard]] auto memory_usage() const -> Util::MemoryUsage;
+
+ protected:
+  QuantizedTernaryLayer _first;
+  std::vector<QuantizedLayer> _layers;  // the layers after the first
+  std::vector<uint8_t> _quantized;      // scratch: quantized inputs of the current layer
+  std::vector<Neuron::Value> _values;   // scratch: activations of the current layer
+};
+
+}  // namespace Inference
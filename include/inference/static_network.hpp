@@ -0,0 +1,173 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "neuron.hpp"
+
+namespace Inference {
+
+// Activation policies for the static kernels, resolved at compile time
+struct TanhActivation {
+  static auto apply(Neuron::Value x) -> Neuron::Value { return Neuron::activation_function(x); }
+};
+
+/*  One fully connected layer of In -> Out neurons with its shape fixed at compile time.
+
+    Weights live in std::array blocks stored input-major (weights[input * Out + neuron]), so
+    the layer is a sequence of broadcast-multiply-adds across a compile-time number of neurons
+    that the compiler fully unrolls and vectorizes, with no per-neuron vectors, bounds checks
+    or validation on the hot path.
+*/
+template <size_t In, size_t Out, typename Activation>
+struct StaticBlock {
+  typedef Neuron::Value Value;
+
+  std::array<Value, In * Out> weights;  // weights[input * Out + neuron]
+  std::array<Value, Out> bias;
+
+  auto load(const std::vector<Neuron>& layer) -> void {
+    for (size_t neuron = 0; neuron < Out; ++neuron) {
+      bias[neuron] = layer[neuron].get_bias();
+      for (size_t input = 0; input < In; ++input) {
+        weights[input * Out + neuron] = layer[neuron].get_input_weight(input);
+      }
+    }
+  }
+
+  auto forward(const Value* in, Value* out) const -> void {
+    std::array<Value, Out> sums = bias;
+    for (size_t input = 0; input < In; ++input) {
+      const Value x = in[input];
+      for (size_t neuron = 0; neuron < Out; ++neuron) {
+        sums[neuron] += x * weights[input * Out + neuron];
+      }
+    }
+    for (size_t neuron = 0; neuron < Out; ++neuron) {
+      out[neuron] = Activation::apply(sums[neuron]);
+    }
+  }
+};
+
+// Type-erased handle so NeuralNetwork can hold whichever shape matched its topology
+class StaticKernel {
+ public:
+  virtual ~StaticKernel() = default;
+
+  // Every layer after the first, starting from the first hidden layer's activations
+  virtual auto propagate(std::span<const Neuron::Value> firstLayer,
+                         std::span<Neuron::Value> outputs) const -> void = 0;
+  // Loads new weights in place; false, leaving the kernel unchanged, if their shape differs
+  virtual auto reload(const std::vector<std::vector<Neuron>>& hidden,
+                      const std::vector<Neuron>& output) -> bool = 0;
+  // sizeof the concrete kernel, whose weights are inline, so its owner can count the block
+  [[nodiscard]] virtual auto get_size_bytes() const -> size_t = 0;
+};
+
+/*  The layers of a network after its first hidden layer, with their shape fixed at compile
+    time: Layers - 1 hidden-to-hidden layers of Hidden neurons, then Outputs.
+
+    NeuralNetwork computes the first layer itself, from pre-activations it keeps up to date as
+    single inputs change, so the kernel holds no first-layer weights and does not depend on the
+    input count. The full network, first layer included, is in tests/helpers/static_network.hpp
+    for tests and benchmarks.
+*/
+template <size_t Hidden, size_t Layers, size_t Outputs, typename Activation>
+class StaticTail final : public StaticKernel {
+  static_assert(Layers >= 1, "StaticTail needs at least one hidden layer");
+
+ public:
+  typedef Neuron::Value Value;
+  typedef std::vector<Neuron> Layer;
+
+  static constexpr size_t HIDDEN = Hidden;
+  static constexpr size_t LAYERS = Layers;
+  static constexpr size_t OUTPUTS = Outputs;
+
+  // Whether hidden and output have this shape; the first layer's input count is not checked
+  static auto matches(const std::vector<Layer>& hidden, const Layer& output) -> bool {
+    if (hidden.size() != Layers || output.size() != Outputs) {
+      return false;
+    }
+    for (size_t layer = 0; layer < Layers; ++layer) {
+      if (hidden[layer].size() != Hidden) {
+        return false;
+      }
+      if (layer == 0) {
+        continue;
+      }
+      for (const Neuron& neuron : hidden[layer]) {
+        if (neuron.get_input_count() != Hidden) {
+          return false;
+        }
+      }
+    }
+    for (const Neuron& neuron : output) {
+      if (neuron.get_input_count() != Hidden) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  auto load(const std::vector<Layer>& hidden, const Layer& output) -> void {
+    if (!matches(hidden, output)) {
+      throw std::invalid_argument("Network topology does not match the static network shape");
+    }
+    for (size_t layer = 1; layer < Layers; ++layer) {
+      _hidden[layer - 1].load(hidden[layer]);
+    }
+    _output.load(output);
+  }
+
+  auto reload(const std::vector<Layer>& hidden, const Layer& output) -> bool override {
+    if (!matches(hidden, output)) {
+      return false;
+    }
+    load(hidden, output);
+    return true;
+  }
+
+  auto propagate(std::span<const Value> firstLayer, std::span<Value> outputs) const
+      -> void override {
+    check_size(firstLayer.size(), Hidden);
+    check_size(outputs.size(), Outputs);
+    std::array<Value, Hidden> activations;
+    std::copy_n(firstLayer.begin(), Hidden, activations.begin());
+    std::array<Value, Hidden> next;
+    for (size_t layer = 0; layer + 1 < Layers; ++layer) {
+      _hidden[layer].forward(activations.data(), next.data());
+      activations = next;
+    }
+    _output.forward(activations.data(), outputs.data());
+  }
+
+  [[nodiscard]] auto get_size_bytes() const -> size_t override { return sizeof(*this); }
+
+  static auto check_size(size_t actual, size_t expected) -> void {
+    if (actual != expected) {
+      throw std::invalid_argument("Static network expected " + std::to_string(expected) +
+                                  " values but got " + std::to_string(actual));
+    }
+  }
+
+ protected:
+  std::array<StaticBlock<Hidden, Hidden, Activation>, Layers - 1> _hidden;
+  StaticBlock<Hidden, Outputs, Activation> _output;
+};
+
+// What the production brain (100 sensing cells, two hidden layers of 16, velocity x/y) runs
+// after its first layer
+typedef StaticTail<16, 2, 2, TanhActivation> ProductionTail;
+
+// Returns a kernel loaded with the layers after the first when their shape is one of the
+// instantiated ones, or nullptr so the caller keeps using the dynamic path
+auto make_static_network(const std::vector<std::vector<Neuron>>& hidden,
+                         const std::vector<Neuron>& output) -> std::unique_ptr<StaticKernel>;
+
+}  // namespace Inference
@@ -0,0 +1,58 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "neuron.hpp"
+#include "util/memory_usage.hpp"
+
+namespace Inference {
+
+/*  TernaryLayer evaluates a fully connected layer whose inputs are all -1, 0 or +1.
+
+    Sensing only ever produces those three values (wall, empty, food) and most cells are
+    empty, so instead of a dense dot product per neuron the inputs are given as two bitmasks:
+    one bit per +1 input and one per -1 input. Pre-activations start at the biases and every
+    set bit adds (or subtracts) one weight column, visiting set bits with count-trailing-zeros.
+
+    Weights are stored input-major so each column is contiguous and the per-bit update is a
+    short vectorizable add across all neurons of the layer. The same columns let callers
+    patch existing pre-activations when only a few inputs change (add_column).
+*/
+class TernaryLayer {
+ public:
+  typedef uint64_t Mask;
+  static constexpr size_t MASK_BITS = 64;
+
+  TernaryLayer() = default;
+
+  // Copies the weights and biases of neurons, which must all have inputCount inputs
+  auto build(std::span<const Neuron> neurons, size_t inputCount) -> void;
+
+  // Writes bias + sum(positive columns) - sum(negative columns) for every neuron into out
+  auto pre_activate(std::span<const Mask> positive,
+                    std::span<const Mask> negative,
+                    std::span<Neuron::Value> out) const -> void;
+
+  // out += scale * (weights of every neuron for input); one axpy per changed input
+  auto add_column(size_t input, Neuron::Value scale, std::span<Neuron::Value> out) const -> void;
+
+  // Splits values into +1 and -1 bitmasks; returns false if any value is not -1, 0 or +1
+  static auto pack(std::span<const Neuron::Value> values,
+                   std::span<Mask> positive,
+                   std::span<Mask> negative) -> bool;
+  static auto mask_count(size_t inputCount) -> size_t;
+
+  [[nodiscard]] auto get_input_count() const -> size_t;
+  [[nodiscard]] auto get_neuron_count() const -> size_t;
+  [[nodiscard]] auto memory_usage() const -> Util::MemoryUsage;
+
+ protected:
+  size_t _inputCount = 0;
+  size_t _neuronCount = 0;
+  std::vector<Neuron::Value> _columns;  // _columns[input * _neuronCount + neuron]
+  std::vector<Neuron::Value> _biases;
+};
+
+}  // namespace Inference
@@ -0,0 +1,56 @@
+#pragma once
+#include <raylib.h>
+
+#include <array>
+#include <string_view>
+#include <vector>
+
+#include "util/memory_usage.hpp"
+
+/*  LabelBatch collects small world-space text labels during a frame and draws them together.
+
+    Labels are formatted into fixed-size buffers, so queuing one never allocates once the
+    batch has grown to its steady-state size. Text is measured from per-glyph advances cached
+    on first use instead of calling MeasureTextEx for every label, and flush() draws all queued
+    text back to back so the renderer stays on the font texture for the whole pass.
+
+    Only single-line printable ASCII is supported.
+*/
+class LabelBatch {
+ public:
+  static constexpr size_t MAX_LABEL_LENGTH = 31;
+  typedef std::array<char, MAX_LABEL_LENGTH + 1> Buffer;
+
+  LabelBatch(float fontSize = 10.0F, float spacing = 1.0F);
+
+  // Writes "(x.xx, y.yy)" into buffer and returns a view of it
+  static auto format_coordinates(Vector2 position, Buffer& buffer) -> std::string_view;
+
+  auto measure(std::string_view text) -> Vector2;
+  auto add(Vector2 position, std::string_view text, Color color) -> void;
+  auto flush() -> void;
+
+  [[nodiscard]] auto size() const -> size_t;
+  [[nodiscard]] auto get_font_size() const -> float;
+  [[nodiscard]] auto get_spacing() const -> float;
+  [[nodiscard]] auto memory_usage() const -> Util::MemoryUsage;
+
+ protected:
+  struct Label {
+    Vector2 position;
+    Color color;
+    Buffer text;
+  };
+
+  auto load_glyph_widths() -> void;
+
+  static constexpr size_t FIRST_GLYPH = 32;
+  static constexpr size_t GLYPH_COUNT = 95;  // printable ASCII
+
+  float _fontSize;
+  float _spacing;
+  bool _glyphsLoaded = false;
+  std::array<float, GLYPH_COUNT> _glyphWidths{};
+  std::vector<Label> _labels;
+  size_t _count = 0;  // queued labels; _labels only grows so its storage is reused
+};
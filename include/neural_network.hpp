@@ -1,9 +1,18 @@
 #pragma once
+#include <array>
+#include <memory>
 #include <nlohmann/json.hpp>
+#include <span>
 #include <vector>
 
+#include "inference/output_cache.hpp"
+#include "inference/pruned_network.hpp"
+#include "inference/quantized_network.hpp"
+#include "inference/static_network.hpp"
+#include "inference/ternary_layer.hpp"
 #include "neuron.hpp"
 #include "random_generator.hpp"
+#include "util/memory_usage.hpp"
 
 // A fully connected neural network
 class NeuralNetwork {
@@ -11,6 +20,17 @@ class NeuralNetwork {
   typedef std::vector<Neuron> Layer;
   typedef std::vector<Neuron::Value> ValueVector;
 
+  // Arithmetic used for forward passes; evolution and serialization always use the float weights.
+  // INT8 networks keep the ternary, incremental and cached paths on int8 weight columns and
+  // build none of the float inference copies. An INT8 brain that has also released its float
+  // layers takes about 6 KB against 26 KB for a FLOAT one (quantized_memory_per_brain.md)
+  typedef enum Precision { FLOAT = 0, INT8 } Precision;
+
+  struct InputChange {
+    size_t index;
+    Neuron::Value value;
+  };
+
   NeuralNetwork();
   NeuralNetwork(const nlohmann::json& json);
   virtual ~NeuralNetwork() = default;
@@ -30,11 +50,25 @@ class NeuralNetwork {
   auto get_input_count() const -> size_t;
 
   auto set_input_values(const ValueVector& input) -> void;
+  auto set_input_values(std::span<const Neuron::Value> input) -> void;
   auto get_input_values() const -> const ValueVector&;
+  // Writable view of the input values so producers can fill them in place; marks outputs stale
+  auto get_input_buffer() -> std::span<Neuron::Value>;
+  // Sets ternary inputs from bitmasks: +1 where positive has a bit, -1 where negative does
+  auto set_input_masks(std::span<const Inference::TernaryLayer::Mask> positive,
+                       std::span<const Inference::TernaryLayer::Mask> negative) -> void;
+  // Sets a few inputs; first-layer sums are patched per change instead of recomputed when
+  // there are at most INCREMENTAL_UPDATE_THRESHOLD changes
+  auto apply_input_changes(std::span<const InputChange> changes) -> void;
 
   auto set_output_neuron_count(size_t count) -> void;
   auto get_output_neuron_count() const -> size_t;
-  auto get_output_values() -> ValueVector;
+  // View of the network's own output buffer, valid until the network is next modified
+  auto get_output_values() -> std::span<const Neuron::Value>;
+  // Forward passes this network object has computed, not counting cached answers
+  auto get_forward_pass_count() const -> uint64_t;
+  // Hits and misses of the per-network cache of outputs for recently seen ternary inputs
+  auto get_output_cache_stats() const -> const Inference::OutputCache::Stats&;
 
   auto get_output_layer() const -> const Layer&;
   auto set_output_layer(const Layer& layer) -> void;
@@ -49,6 +83,49 @@ class NeuralNetwork {
 
   auto randomize() -> void;
 
+  // Every bias and weight as one flat array: layer by layer (hidden layers, then the output
+  // layer), and for each neuron its bias followed by its input weights
+  auto get_parameter_count() const -> size_t;
+  auto get_parameters(std::span<Neuron::Value> out) const -> void;
+  auto set_parameters(std::span<const Neuron::Value> parameters) -> void;
+  // Calls edit(layerIndex, neuronIndex, neuron) for every neuron in parameter order, with the
+  // output layer last at layerIndex == get_hidden_layer_count(), then invalidates once
+  template <typename Editor>
+  auto edit_neurons(Editor&& edit) -> void {
+    require_float_weights();
+    for (size_t layerIndex = 0; layerIndex < _hiddenLayers.size(); ++layerIndex) {
+      for (size_t neuronIndex = 0; neuronIndex < _hiddenLayers[layerIndex].size(); ++neuronIndex) {
+        edit(layerIndex, neuronIndex, _hiddenLayers[layerIndex][neuronIndex]);
+      }
+    }
+    for (size_t neuronIndex = 0; neuronIndex < _outputLayer.size(); ++neuronIndex) {
+      edit(_hiddenLayers.size(), neuronIndex, _outputLayer[neuronIndex]);
+    }
+    _ready = false;
+    weights_changed();
+  }
+
+  auto set_precision(Precision precision) -> void;
+  auto get_precision() const -> Precision;
+  // Builds the int8 copy and frees the float weights of every neuron, keeping the shape, for
+  // INT8 networks that will only run forward passes (an ant's brain, whose genome holds the
+  // floats). Copies keep the int8 copy; anything that needs the floats, from editing or
+  // reshaping to serialization or a precision change, throws std::logic_error afterwards
+  auto release_float_weights() -> void;
+  auto has_float_weights() const -> bool;
+
+  // Float forward passes drop the weights with |w| below threshold, and the hidden neurons that
+  // are left with no way to reach the outputs, running a compact block-sparse copy instead of
+  // the ternary columns and static kernel. The dense layers are left untouched for evolution.
+  // 0 disables pruning, INT8 takes precedence
+  auto set_prune_threshold(float threshold) -> void;
+  auto get_prune_threshold() const -> float;
+  // Fraction of weights below the prune threshold, 0 when not pruning
+  auto get_sparsity() const -> float;
+
+  // Neurons, scratch buffers and every inference copy of the weights built so far
+  auto memory_usage() const -> Util::MemoryUsage;
+
   auto to_json() const -> nlohmann::json;
 
  protected:
@@ -56,6 +133,20 @@ class NeuralNetwork {
   auto configure_hidden_layers() -> void;
   auto get_hidden_layer_weight_count(size_t layer_idx) -> size_t;
   auto configure_hidden_layer(size_t idx) -> void;
+  auto weights_changed() -> void;
+  auto require_float_weights() const -> void;
+  // Takes over the int8 copy of a network whose float weights were released
+  auto adopt_released_weights(Inference::QuantizedNetwork quantized) -> void;
+  auto first_layer() const -> const Layer&;
+  auto first_layer_columns() -> const Inference::TernaryLayer&;
+  auto static_network() -> const Inference::StaticKernel*;
+  auto quantized_network() -> Inference::QuantizedNetwork&;
+  auto pruned_network() -> Inference::PrunedNetwork&;
+  auto is_pruning() const -> bool;
+  // Patches the first-layer sums for one changed input through the columns forward passes use
+  auto add_first_layer_column(size_t input, Neuron::Value scale) -> void;
+  auto can_update_incrementally(size_t changes) const -> bool;
+  auto compute_first_layer_sums() -> void;
   auto compute() -> void;
   auto validate() -> void;
 
@@ -63,11 +154,43 @@ class NeuralNetwork {
   const size_t DEFAULT_HIDDEN_LAYER_NEURON_COUNT = 16;
   const size_t DEFAULT_INPUT_COUNT = 100;
   const size_t DEFAULT_OUTPUT_NEURON_COUNT = 2;
+  const size_t INCREMENTAL_UPDATE_THRESHOLD = 16;
+  // Patched sums slowly accumulate rounding error, so they are recomputed after this many
+  const size_t MAX_INCREMENTAL_UPDATES = 128;
 
   std::vector<Layer> _hiddenLayers;
   Layer _outputLayer;
   ValueVector _inputsValues;
   ValueVector _outputValues;
+  std::array<ValueVector, 2> _layerValues;  // ping-pong scratch for hidden layer activations
+
+  // First layer transposed for -1/0/+1 inputs, rebuilt lazily after any weight or shape change
+  Inference::TernaryLayer _ternaryLayer;
+  std::vector<Inference::TernaryLayer::Mask> _positiveInputs;
+  std::vector<Inference::TernaryLayer::Mask> _negativeInputs;
+  bool _ternaryLayerStale = true;
+  bool _inputMasksCurrent = false;  // the masks already describe _inputsValues
+
+  // First layer pre-activations for the current inputs, kept up to date across small changes
+  ValueVector _firstLayerSums;
+  bool _firstLayerSumsValid = false;
+  size_t _incrementalUpdates = 0;
+
+  Inference::OutputCache _outputCache;
+  uint64_t _forwardPasses = 0;
+
+  // Compile-time shaped copy of the layers after the first, when the topology is one of the
+  // instantiated shapes (see Inference::make_static_network); null means the dynamic path
+  std::unique_ptr<Inference::StaticKernel> _staticNetwork;
+  bool _staticNetworkStale = true;
+
+  Precision _precision = FLOAT;
+  Inference::QuantizedNetwork _quantizedNetwork;  // int8 copy of the weights when INT8
+  bool _quantizedNetworkStale = true;
+  bool _floatWeightsReleased = false;  // neurons are empty, the int8 copy is all that is left
+  float _pruneThreshold = 0.0F;
+  Inference::PrunedNetwork _prunedNetwork;  // compact copy of the kept weights when pruning
+  bool _prunedNetworkStale = true;
   bool _validated = false;
 
   size_t _hiddenLayerNeuronCount;
@@ -1,9 +1,11 @@
 #pragma once
 #include <cmath>
 #include <nlohmann/json.hpp>
+#include <span>
 #include <vector>
 
 #include "random_generator.hpp"
+#include "util/memory_usage.hpp"
 
 class Neuron {
  public:
@@ -21,11 +23,20 @@ class Neuron {
 
   auto set_input_weight(size_t idx, Value weight) -> void;
   auto get_input_weight(size_t idx) const -> Value;
+  auto get_weights() const -> std::span<const Value>;
+  // Writable view for editing weights in place
+  auto get_weights() -> std::span<Value>;
+  // Replaces every weight at once; weights must match the input count
+  auto set_weights(std::span<const Value> weights) -> void;
 
   auto set_bias(double bias) -> void;
   auto get_bias() const -> Value;
 
   auto get_output() -> Value;
+  // Output for inputs without storing them; used by NeuralNetwork so layers never copy inputs
+  auto activate(std::span<const Value> inputs) const -> Value;
+  // bias + weights . inputs, i.e. activate() before the activation function
+  auto weighted_sum(std::span<const Value> inputs) const -> Value;
 
   auto get_input_count() const -> size_t;
   auto set_input_count(size_t) -> void;
@@ -40,11 +51,18 @@ class Neuron {
   auto randomize(RandomGenerator& rng) -> void;
 
   auto to_json() const -> nlohmann::json;
+  // Its weight and input buffers
+  auto memory_usage() const -> Util::MemoryUsage;
 
- protected:
   static auto activation_function(Value x) -> Value {
     return tanh(x);
   }
+  // weight, or 0 when its magnitude is below a pruning threshold
+  static auto prune(Value weight, Value threshold) -> Value {
+    return std::abs(weight) < threshold ? 0.0f : weight;
+  }
+
+ protected:
 
   Value _value = 0;
   Value _bias = 0;
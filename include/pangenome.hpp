@@ -6,6 +6,7 @@
 
 #include "genome.hpp"
 #include "random_generator.hpp"
+#include "util/half.hpp"
 
 class Pangenome {
  public:
@@ -23,11 +24,21 @@ class Pangenome {
   Pangenome(Pangenome&& other) = default;
   Pangenome& operator=(Pangenome&& other) = default;
 
+  // Genomes are stored compacted to the weight format and expanded again when sampled
   auto add(Genome&& genome) -> void;
   auto sample_top_cycle() -> const Genome&;
   auto sample_random() -> const Genome&;
   auto size() const -> size_t;
   auto empty() const -> bool;
+  // Fitness of the best stored genome, 0 when empty
+  auto get_top_fitness() const -> double;
+  // Recompacts every stored genome when the format changes
+  auto set_weight_format(Util::WeightFormat format) -> void;
+  auto get_weight_format() const -> Util::WeightFormat;
+  // Bytes taken by the stored genomes' biases and weights
+  auto get_weight_bytes() const -> size_t;
+  // The stored genomes and everything they own
+  auto memory_usage() const -> Util::MemoryUsage;
   auto to_json() const -> nlohmann::json;
 
   auto operator==(const Pangenome& other) const -> bool;
@@ -35,6 +46,7 @@ class Pangenome {
  private:
   std::vector<Genome> _genomes;  // Always sorted by fitness descending
   size_t _topCycleIndex = 0;
+  Util::WeightFormat _weightFormat = Util::FP32;
   mutable RandomGenerator _rng;
 
   auto maintain_sorted_order() -> void;
@@ -3,10 +3,14 @@
 #include <raylib.h>
 
 #include <ant.hpp>
+#include <array>
 #include <containers/circular_stats.hpp>
+#include <containers/min_max_pyramid.hpp>
+#include <containers/spatial_grid.hpp>
 #include <functional>
 #include <genome.hpp>
 #include <nlohmann/json.hpp>
+#include <util/tick_profile.hpp>
 #include <vector>
 
 #include "pangenome.hpp"
@@ -17,6 +21,21 @@ class World;
 class Population {
  public:
   typedef Containers::CircularStats<double> FitnessData;
+  // The history charts draw about one point per pixel of their width, so each level keeps a
+  // chart's width of buckets; 20 levels reach back 2^28 ticks, over 50 days at 60 a second
+  static constexpr size_t HISTORY_BUCKETS = 512;
+  static constexpr size_t HISTORY_LEVELS = 20;
+  typedef Containers::MinMaxPyramid<float, HISTORY_BUCKETS, HISTORY_LEVELS> History;
+  // GENOME_FITNESS has a sample per retired genome, the others a sample per tick
+  typedef enum HistorySeries {
+    GENOME_FITNESS = 0,
+    MEAN_FITNESS,
+    TOP_FITNESS,
+    PANGENOME_SIZE,
+    BIRTHS,
+    DEATHS,
+    HISTORY_SERIES_COUNT
+  } HistorySeries;
   Population(World& world);
   Population(const nlohmann::json& j, World& world);
   ~Population() = default;
@@ -25,10 +44,26 @@ class Population {
   [[nodiscard]] auto get_size() const -> int;
 
   auto update(float time) -> void;
+  // Senses, then thinks and moves the living ants while the ants that died are retired and
+  // replaced, adding each phase's time and allocations to profile. An exclusive profile
+  // retires and replaces after moving instead
+  auto update(float time, Util::TickProfile& profile) -> void;
 
   [[nodiscard]] auto get_collisions(const Vector2& position, float radius)
       -> std::vector<std::reference_wrapper<Ant>>;
 
+  static constexpr size_t NO_ANT = SIZE_MAX;
+
+  // Index of the lowest-index ant touching the circle, or NO_ANT. Uses the spatial index as
+  // of the last refresh_spatial_index(), so concurrent callers never rebuild it
+  [[nodiscard]] auto first_contact(const Vector2& position, float radius) const -> size_t;
+  // Calls visit(index, ant) for ants touching the circle until visit returns false; the
+  // order follows the spatial index, not ant indices
+  template <typename Visitor>
+  auto for_each_contact(const Vector2& position, float radius, Visitor&& visit) const -> void;
+  // Rebuilds the spatial index if ants were added, moved or replaced since the last build
+  auto refresh_spatial_index() -> void;
+
   Population(const Population& other);
   Population& operator=(const Population& other);
   Population(Population&& other);
@@ -39,12 +74,45 @@ class Population {
 
   auto get_fitness_data() -> FitnessData&;
   auto get_fitness_data() const -> const FitnessData&;
+  // The whole run's history of a series, coarser the older it is
+  auto get_history(HistorySeries series) const -> const History&;
+  // Genomes of retired ants that new ants are bred from
+  auto get_pangenome() const -> const Pangenome&;
 
   auto get_ants() -> std::vector<Ant>&;
+  auto get_ants() const -> const std::vector<Ant>&;
+  // For changes that do not move the ant, so the spatial index stays valid
+  auto get_ant(size_t index) -> Ant&;
+
+  // Brain output cache hits and misses summed over the living ants
+  [[nodiscard]] auto get_output_cache_stats() const -> Inference::OutputCache::Stats;
+  // Mean fraction of brain weights skipped by pruning over the living ants
+  [[nodiscard]] auto get_mean_sparsity() const -> float;
+
+  // What grows with the ant count: the ants with their genomes and brains, and the lists and
+  // spatial index over them
+  [[nodiscard]] auto get_ants_memory_usage() const -> Util::MemoryUsage;
+  // The buckets of every history series, allocated by its first sample
+  [[nodiscard]] auto get_history_memory_usage() const -> Util::MemoryUsage;
+  // The ants, the pangenome and the fitness statistics and histories
+  [[nodiscard]] auto memory_usage() const -> Util::MemoryUsage;
+
+  // Calls visit(Ant&) for every ant that may lie inside rect, without scanning the whole population
+  template <typename Visitor>
+  auto for_each_in_rect(const Rectangle& rect, Visitor&& visit) -> void;
 
  protected:
   auto reproduce() -> void;
   auto create_ant() -> Ant;
+  auto update_spatial_index() -> void;
+
+  // Tick phases, in order; sense() sorts the ants into _living and _retiring for the rest
+  auto sense(float time) -> void;
+  // Returns the forward passes the brains computed
+  auto think() -> uint64_t;
+  auto move(float time) -> void;
+  auto retire() -> void;
+  auto record_history() -> void;
 
   std::vector<Ant> _ants;
   World& _world;
@@ -53,6 +121,37 @@ class Population {
   int _size;
 
   Pangenome _pangenome;
+  RandomGenerator _breedingRng;  // crossover masks, so the sampled parents are only read
 
   FitnessData _fitnessData;
+  std::array<History, HISTORY_SERIES_COUNT> _history;
+  // Ants created during the current tick
+  size_t _births = 0;
+
+  // Ant indices split by sense(); think() and move() only touch _living and retire() only
+  // _retiring, which is what lets them run at the same time
+  std::vector<size_t> _living;
+  std::vector<size_t> _retiring;
+
+  Containers::SpatialGrid _spatialIndex;
+  bool _spatialIndexDirty = true;
+  static constexpr float INDEX_CELL_SIZE = 64.0F;
 };
+
+template <typename Visitor>
+auto Population::for_each_contact(const Vector2& position, float radius, Visitor&& visit) const
+    -> void {
+  // Ants are bucketed by centre, and no ant's body reaches past its texture width from it
+  const float reach = radius + Ant::TEXTURE_WIDTH;
+  const Rectangle rect = {position.x - reach, position.y - reach, 2.0F * reach, 2.0F * reach};
+  _spatialIndex.query(rect, [&](size_t index) -> bool {
+    const Ant& ant = _ants[index];
+    return !ant.collides(position, radius) || visit(index, ant);
+  });
+}
+
+template <typename Visitor>
+auto Population::for_each_in_rect(const Rectangle& rect, Visitor&& visit) -> void {
+  refresh_spatial_index();
+  _spatialIndex.query(rect, [&](size_t index) { visit(_ants[index]); });
+}
@@ -1,7 +1,10 @@
 #pragma once
+#include <array>
 #include <chrono>
 #include <cmath>
+#include <cstdint>
 #include <random>
+#include <span>
 
 #include "XoshiroCpp.hpp"
 
@@ -9,6 +12,9 @@ class RandomGenerator {
   mutable XoshiroCpp::Xoshiro256PlusPlus gen;
 
  public:
+  // Interleaved generator states used by the bulk fill_* functions
+  static constexpr size_t LANES = 4;
+
   // Default constructor with automatic random seeding
   RandomGenerator() : gen(std::random_device{}()) {}
 
@@ -27,7 +33,39 @@ class RandomGenerator {
     return std::normal_distribution<double>(mean, stddev)(gen);
   }
 
+  // 64 independent fair bits
+  uint64_t bits() const {
+    return gen();
+  }
+
   bool coin_flip() {
     return uniform(0.0, 1.0) < 0.5;
   }
-};
\ No newline at end of file
+
+  // Bulk generation for callers that need many values at once. These draw from LANES
+  // xoshiro256++ states stepped side by side (seeded from this generator on first use), so the
+  // state updates vectorize across lanes instead of forming one serial dependency chain.
+  void fill_bits(std::span<uint64_t> out) const;
+  // Floats in [min, max) with 24 random mantissa bits each, two per 64-bit word
+  void fill_uniform(std::span<float> out, float min = 0.0F, float max = 1.0F) const;
+  // Marsaglia-Tsang ziggurat with 128 layers; almost every value costs one 32-bit draw
+  void fill_normal(std::span<float> out, float mean = 0.0F, float stddev = 1.0F) const;
+  // Word whose bits are each set independently with probability p, resolved to 1/65536
+  uint64_t bernoulli_mask(double p) const;
+
+ private:
+  typedef std::array<uint64_t, LANES> Lane;
+
+  struct Lanes {
+    alignas(32) Lane s0{};
+    alignas(32) Lane s1{};
+    alignas(32) Lane s2{};
+    alignas(32) Lane s3{};
+    bool seeded = false;
+  };
+
+  void seed_lanes() const;
+  float normal_tail(int32_t draw, size_t layer) const;
+
+  mutable Lanes lanes;
+};
@@ -13,6 +13,12 @@ Rectangle RotateRect(Rectangle rectangle, Vector2 position, float rotation);
 // check if a rect (inner) is within a rect (outer)
 bool IsRectContained(Rectangle inner, Rectangle outer);
 
+// world-space bounding rectangle of everything a camera shows on a screen of the given size
+Rectangle GetCameraViewRect(Camera2D camera, int screenWidth, int screenHeight);
+
+// grow a rect by margin on every side
+Rectangle ExpandRect(Rectangle rectangle, float margin);
+
 #ifdef __cplusplus
 }
 #endif
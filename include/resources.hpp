@@ -3,7 +3,9 @@
 class World;
 class Population;
 
+#include <containers/spatial_grid.hpp>
 #include <nlohmann/json.hpp>
+#include <span>
 #include <vector>
 
 #include "food.hpp"
@@ -24,21 +26,46 @@ class Resources {
   auto get_food_count() const -> int;
   auto set_food_count(int size) -> void;
 
+  // Tops the food up to the food count and respawns what was eaten; it does not feed the ants
   auto update(float time) -> void;
 
-  auto draw() const -> void;
+  // Draws the food overlapping view, as dots instead of sprites when zoomed out
+  auto draw(const Rectangle& view, bool dots) const -> void;
 
+  // A piece of uneaten food and the ant that gets to eat it
+  struct Contact {
+    size_t food;
+    size_t ant;
+  };
+
+  // Moves eaten food to a new spawn position and refreshes the food index
+  auto respawn_food() -> void;
+  // Finds, for every uneaten piece of food, the lowest-index ant touching it. Cells of the food
+  // index are searched in parallel; the contacts come back in food order and stay valid until
+  // the next call
+  auto generate_contacts(Population& population) -> std::span<const Contact>;
+  // Lets every ant touching uneaten food eat it
   auto feed_ants(Population& population) -> void;
   auto food_in_rect(const Rectangle& rect) const -> bool;
+  [[nodiscard]] auto get_food() const -> const std::vector<Food>&;
+
+  // The food, its index and the contact buffers
+  [[nodiscard]] auto memory_usage() const -> Util::MemoryUsage;
 
   auto to_json() const -> nlohmann::json;
 
  protected:
   auto food_position() -> Vector2;
+  auto update_spatial_index() -> void;
 
   World& _world;
   size_t _food_count;
   std::vector<Food> _food;
+  Containers::SpatialGrid _foodIndex;
+  // Contact buffers reused across ticks; _contactAnts holds one slot per piece of food
+  std::vector<size_t> _contactAnts;
+  std::vector<Contact> _contacts;
 
   const size_t DEFAULT_COUNT = 200;
+  static constexpr float INDEX_CELL_SIZE = 64.0F;
 };
@@ -2,9 +2,12 @@
 #include <raylib.h>
 
 #include <cstddef>  // For size_t
+#include <cstdint>
+#include <span>
 #include <vector>
 
 #include <neuron.hpp>
+#include <util/memory_usage.hpp>
 
 /*  Surroundings is a 2D grid of types that are encoded.
     The types are:
@@ -16,6 +19,11 @@
     The bottom-right corner of the grid is (width-1, height-1)
     The grid is encoded left to right, top to bottom.
     The encoded vector is a flat vector of values between -1 and 1.
+
+    Cells are stored as two flat bitmasks in that same order, one bit per cell for food and
+    one for walls (a cell with neither bit set is empty). A 10x10 grid is two 128-bit masks,
+    rows can be written a whole word at a time, and comparing, diffing or hashing two sensing
+    results only touches a few words.
 */
 
 class Surroundings {
@@ -23,6 +31,8 @@ class Surroundings {
 
   typedef enum Type { FOOD=0, EMPTY, WALL } Type;
   typedef unsigned char CountType;
+  typedef uint64_t Mask;
+  static constexpr size_t MASK_BITS = 64;
 
   Surroundings() = default;
   Surroundings(const Surroundings& other) = default;
@@ -30,23 +40,51 @@ class Surroundings {
   auto operator=(const Surroundings& other) -> Surroundings& = default;
   auto operator=(Surroundings&& other) -> Surroundings& = default;
 
+  // Equal when the dimensions and every cell match
+  auto operator==(const Surroundings& other) const -> bool;
+
   auto set_dimensions(size_t width, size_t height) -> void;
   auto set_type(size_t x, size_t y, Type type) -> void;
+  // Writes row y at once: bit x of food/wall marks cell x; rows may be at most 64 cells wide
+  auto set_row(size_t y, Mask food, Mask wall) -> void;
+  auto get_type(size_t x, size_t y) const -> Type;
 
   auto get_dimensions() const -> Vector2;
   auto get_width() const -> size_t;
   auto get_height() const -> size_t;
 
+  // Bit y * width + x is set for every food (wall) cell
+  auto get_food_mask() const -> std::span<const Mask>;
+  auto get_wall_mask() const -> std::span<const Mask>;
+
+  // Sets a bit in out for every cell that differs from other and returns how many differ
+  auto diff(const Surroundings& other, std::span<Mask> out) const -> size_t;
+  auto hash() const -> size_t;
+
   auto get_encoded_surroundings() -> const std::vector<Neuron::Value>&;
 
+  // Writes the encoded grid straight into out (e.g. a network's input buffer) and clears changed()
+  auto encode(std::span<Neuron::Value> out) -> void;
+
   auto changed() const -> bool;
+  // For consumers that read the masks directly instead of encoding
+  auto clear_changed() -> void;
+
+  // Food and wall rows and the encoded grid
+  auto memory_usage() const -> Util::MemoryUsage;
 
  protected:
-  std::vector<std::vector<Type>> _surroundingsType;
+  size_t _width = 0;
+  size_t _height = 0;
+  std::vector<Mask> _food;
+  std::vector<Mask> _wall;
   std::vector<Neuron::Value> _surroundingsEncoded;
 
-  bool _changed = false;
+  bool _changed = false;         // changed since the encoding was last consumed
+  bool _encodedStale = false;    // _surroundingsEncoded needs rebuilding
 
   static auto encode_type(Type type) -> float;
+  static auto write_bits(std::vector<Mask>& masks, size_t offset, size_t count, Mask bits)
+      -> bool;
   auto update_encoded_surroundings() -> void;
 };
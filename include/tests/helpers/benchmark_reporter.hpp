@@ -1,26 +1,119 @@
 #pragma once
 #include <chrono>
+#include <cstdint>
 #include <ctime>
 #include <iomanip>
+#include <nlohmann/json.hpp>
+#include <optional>
 #include <sstream>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include "tests/helpers/latency_histogram.hpp"
+#include "tests/helpers/perf_counters.hpp"
+#include "util/allocation_counter.hpp"
+#include "util/memory_usage.hpp"
+
+/*  BenchmarkReporter writes a Markdown report and a JSON file with the same name stem.
+
+    The JSON holds the raw samples (ns), summary statistics and the environment: CPU model and
+    features, the instruction sets compiled in, compiler, git revision and thread counts.
+    Raw samples outside Tukey's fences (1.5 and 3 interquartile ranges beyond the quartiles)
+    are annotated as mild or severe outliers, and a LatencyHistogram adds tail percentiles.
+    Hardware counter samples add per-iteration and per-unit-of-work counts with IPC and
+    misses per thousand instructions, or the reason counters were unavailable. Heap
+    allocation totals add allocations and bytes per iteration for each phase of the work, and
+    a memory footprint adds the heap held by each part of the benchmarked state, per object.
+
+    Environment variables control the output:
+      BENCHMARK_OUTPUT_DIR            directory for the reports, the working directory if unset
+      BENCHMARK_BASELINE_DIR          directory of earlier JSON results to compare against
+      BENCHMARK_REGRESSION_THRESHOLD  slowdown of the median that counts as a regression (0.05)
+      BENCHMARK_SIGNIFICANCE          Mann-Whitney U p-value below which a change is real (0.01)
+      BENCHMARK_GIT_REVISION          overrides the revision recorded at configure time
+
+    With a baseline, a benchmark whose median is slower by more than the threshold with a
+    significant Mann-Whitney U test fails the running test case, so the benchmark executable
+    exits non-zero.
+*/
 class BenchmarkReporter {
  public:
+  // Samples (ns) measured with the work limited to a number of threads
+  struct ScalingRun {
+    size_t threads;
+    std::vector<double> data;
+  };
+
+  // Hardware counters with one sample per iteration; work_per_iteration is how many work_units
+  // (ants, neurons) one iteration processes, so counts can be given per unit as well
+  struct CounterReport {
+    std::vector<PerfCounters::Sample> samples{};
+    double work_per_iteration = 1.0;
+    std::string work_unit{};
+    std::string error{};  // why there are no samples
+  };
+
+  // Heap allocations summed over iterations (ticks) of some work, split into its phases
+  struct AllocationReport {
+    struct Phase {
+      std::string name{};
+      Util::AllocationCounter::Counts total{};
+    };
+    std::vector<Phase> phases{};
+    uint64_t iterations = 0;
+    std::string iteration_unit = "iteration";
+  };
+
+  // Heap held by the parts of the benchmarked state; count objects of unit make up a part,
+  // giving its cost per object, and parts with no count are only totalled
+  struct MemoryReport {
+    struct Part {
+      std::string name{};
+      Util::MemoryUsage usage{};
+      size_t count = 0;
+      std::string unit{};
+    };
+    std::vector<Part> parts{};
+  };
+
   BenchmarkReporter() = default;
   BenchmarkReporter(const std::string& title, const std::string& output_file);
 
   auto set_title(const std::string& title) -> void;
   auto set_data(const std::vector<double>& data) -> void;
+  // Adds a thread scaling section: speedup and parallel efficiency relative to the first run
+  auto set_scaling_runs(const std::vector<ScalingRun>& runs) -> void;
+  // Adds a latency percentile section; a report may have a histogram and no raw data
+  auto set_histogram(const LatencyHistogram& histogram) -> void;
+  auto set_counters(const CounterReport& counters) -> void;
+  auto set_allocations(const AllocationReport& allocations) -> void;
+  auto set_memory(const MemoryReport& memory) -> void;
   auto generate_report() -> void;
   auto write_to_file() -> void;
 
+  // Only valid after generate_report()
+  [[nodiscard]] auto to_json() const -> const nlohmann::json&;
+  [[nodiscard]] auto has_regression() const -> bool;
+  // Where a report file goes: under BENCHMARK_OUTPUT_DIR when it is set. Summaries that sit
+  // next to the reports use it too
+  static auto output_path(const std::string& file_name) -> std::string;
+
  private:
   std::string _title;
   std::string _output_file;
   std::vector<double> _raw_data;
+  std::vector<ScalingRun> _scaling_runs;
+  std::optional<LatencyHistogram> _histogram;
+  std::optional<CounterReport> _counters;
+  std::optional<AllocationReport> _allocations;
+  std::optional<MemoryReport> _memory;
+  std::vector<size_t> _mild_outliers;
+  std::vector<size_t> _severe_outliers;
   std::string _report_content;
+  nlohmann::json _json;
+  bool _regression = false;
+  double _median;
   double _mean;
   double _std_dev;
   double _min;
@@ -29,13 +122,26 @@ class BenchmarkReporter {
   auto calculate_statistics() -> void;
   auto format_markdown_table() -> std::string;
   auto format_raw_data_table() -> std::string;
+  auto format_scaling_table() -> std::string;
+  auto format_histogram_table() -> std::string;
+  auto format_counter_table() -> std::string;
+  auto counters_json() const -> nlohmann::json;
+  auto format_allocation_table() -> std::string;
+  auto allocations_json() const -> nlohmann::json;
+  auto format_memory_table() -> std::string;
+  auto memory_json() const -> nlohmann::json;
+  auto find_outliers() -> void;
+  auto compare_to_baseline() -> std::string;
+  auto environment_json() -> nlohmann::json;
   auto get_system_info() -> std::string;
   auto get_timestamp() -> std::string;
   auto get_compiler_info() -> std::string;
 
   // Smart unit selection methods
   auto determine_best_unit() -> std::string;
+  static auto determine_unit(double value_ns) -> std::string;
   auto convert_to_best_unit(double value_ns) -> double;
+  static auto convert_to_unit(double value_ns, const std::string& unit) -> double;
   auto get_unit_conversion_factor() -> double;
 };
 
@@ -43,6 +149,16 @@ class StatisticalBenchmarkRunner {
  public:
   static constexpr size_t NUM_ITERATIONS = 30;
 
+  // Sampling stops once the 95% confidence interval of the mean is within target_relative_ci
+  // of it, after at least min_iterations and at most max_iterations or max_seconds
+  struct AdaptivePolicy {
+    size_t warm_up = 3;  // runs discarded before sampling
+    size_t min_iterations = 10;
+    size_t max_iterations = 1000;
+    double target_relative_ci = 0.02;
+    double max_seconds = 60.0;
+  };
+
   template <typename BenchmarkType>
   static auto run_statistical_benchmark(BenchmarkType& benchmark) -> std::vector<double> {
     std::vector<double> results;
@@ -57,8 +173,50 @@ class StatisticalBenchmarkRunner {
     return results;
   }
 
+  // Durations in ns, as many as policy needs; counters, if given, gets each sample's counts
+  template <typename BenchmarkType>
+  static auto run_adaptive_benchmark(BenchmarkType& benchmark, const AdaptivePolicy& policy = {},
+                                     std::vector<PerfCounters::Sample>* counters = nullptr)
+      -> std::vector<double> {
+    for (size_t i = 0; i < policy.warm_up; ++i) {
+      benchmark.reset();
+      benchmark.run();
+    }
+
+    std::vector<double> results;
+    double elapsed = 0.0;
+    while (results.size() < policy.max_iterations) {
+      benchmark.reset();
+      benchmark.run();
+      results.push_back(static_cast<double>(benchmark.get_duration_ns().count()));
+      if (counters != nullptr) {
+        counters->push_back(benchmark.get_counters());
+      }
+      elapsed += results.back() / 1e9;
+      if (results.size() >= policy.min_iterations &&
+          (relative_ci(results) <= policy.target_relative_ci || elapsed >= policy.max_seconds)) {
+        break;
+      }
+    }
+    return results;
+  }
+
+  // Half-width of the normal 95% confidence interval of the mean, relative to the mean
+  static auto relative_ci(const std::vector<double>& data) -> double;
+  // Linearly interpolated percentile in [0, 100]
+  static auto calculate_percentile(std::vector<double> data, double percentile) -> double;
   static auto calculate_mean(const std::vector<double>& data) -> double;
+  static auto calculate_median(std::vector<double> data) -> double;
   static auto calculate_std_dev(const std::vector<double>& data, double mean) -> double;
   static auto get_min(const std::vector<double>& data) -> double;
   static auto get_max(const std::vector<double>& data) -> double;
+
+  // Two-sided p-value of the Mann-Whitney U test (normal approximation with tie correction)
+  // that both samples come from the same distribution
+  static auto mann_whitney_p(const std::vector<double>& a, const std::vector<double>& b)
+      -> double;
+  // Percentile bootstrap confidence interval of median(b) / median(a)
+  static auto bootstrap_median_ratio(const std::vector<double>& a, const std::vector<double>& b,
+                                     double confidence = 0.95, size_t resamples = 2000,
+                                     uint64_t seed = 42) -> std::pair<double, double>;
 };
\ No newline at end of file
@@ -0,0 +1,28 @@
+#pragma once
+#include <raylib.h>
+
+#include <string>
+
+#include "texture_cache.hpp"
+
+// A TextureCache with placeholder ant and food entries, so worlds can be simulated without a
+// window or GPU. The placeholders are never uploaded, so they must not be drawn
+class HeadlessTextureCache : public TextureCache {
+ public:
+  HeadlessTextureCache() {
+    Texture2D placeholder{};
+    placeholder.id = 1;
+    placeholder.width = 16;
+    placeholder.height = 16;
+    placeholder.mipmaps = 1;
+    placeholder.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    for (const std::string name : {"ants_0", "food_0"}) {
+      _textures.insert(name, placeholder);
+    }
+    _defaultTextureName = "ants_0";
+  }
+
+  ~HeadlessTextureCache() {
+    _textures.clear();  // nothing was loaded, so there is nothing to unload
+  }
+};
@@ -0,0 +1,57 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/*  LatencyHistogram records durations into log-bucketed counters, HDR histogram style.
+
+    Every power of two is split into SUB_BUCKETS linear buckets, so any recorded value is
+    known to within 1 / SUB_BUCKETS (under 1%) of itself from 1 ns up to the full uint64
+    range. Recording is a couple of bit operations and an increment into a fixed array that
+    is allocated once, so millions of per-tick samples cost next to nothing.
+
+    The first get_warm_up() samples are counted as discarded instead of recorded, so caches,
+    allocators and branch predictors can settle before the distribution is taken.
+*/
+class LatencyHistogram {
+ public:
+  static constexpr uint32_t SUB_BUCKET_BITS = 7;
+  static constexpr uint64_t SUB_BUCKETS = uint64_t{1} << SUB_BUCKET_BITS;
+
+  LatencyHistogram();
+
+  auto record(uint64_t value) -> void;
+  auto reset() -> void;
+  // Adds other's recorded samples; warm-up settings and discards are not merged
+  auto merge(const LatencyHistogram& other) -> void;
+
+  auto set_warm_up(size_t samples) -> void;
+  [[nodiscard]] auto get_warm_up() const -> size_t;
+  [[nodiscard]] auto get_discarded() const -> size_t;
+
+  [[nodiscard]] auto count() const -> uint64_t;
+  [[nodiscard]] auto min() const -> uint64_t;
+  [[nodiscard]] auto max() const -> uint64_t;
+  [[nodiscard]] auto mean() const -> double;
+  // Smallest bucket upper bound with at least percentile% of the samples at or below it,
+  // capped at the largest recorded value; percentile is in [0, 100]
+  [[nodiscard]] auto percentile(double percentile) const -> uint64_t;
+  // Samples in buckets that lie entirely above value
+  [[nodiscard]] auto count_above(uint64_t value) const -> uint64_t;
+
+  [[nodiscard]] static auto bucket_index(uint64_t value) -> size_t;
+  [[nodiscard]] static auto bucket_lower(size_t index) -> uint64_t;
+  [[nodiscard]] static auto bucket_upper(size_t index) -> uint64_t;
+
+ protected:
+  // Values below SUB_BUCKETS get a bucket each, then SUB_BUCKETS per remaining power of two
+  static constexpr size_t BUCKET_COUNT = SUB_BUCKETS * (64 - SUB_BUCKET_BITS + 1);
+
+  std::vector<uint64_t> _counts;
+  uint64_t _count = 0;
+  uint64_t _min = UINT64_MAX;
+  uint64_t _max = 0;
+  double _sum = 0.0;
+  size_t _warmUp = 0;
+  size_t _discarded = 0;
+};
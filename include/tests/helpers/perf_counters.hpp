@@ -0,0 +1,70 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/*  PerfCounters reads hardware performance counters through Linux perf_event_open.
+
+    The events are opened as small groups so the members of a group are always counted over
+    the same interval; counts are scaled up when the kernel had to multiplex a group. Only
+    user-space events of the calling thread are counted, so work handed to TBB workers is
+    not included - measure parallel code with a single thread for counter data.
+
+    Any event the kernel or container refuses is left out, and when none can be opened
+    is_available() is false and get_error() says why. Nothing is counted on other systems.
+    Set BENCHMARK_PERF_COUNTERS=1 to turn counters on for every BenchmarkBase.
+*/
+class PerfCounters {
+ public:
+  typedef enum Event {
+    CYCLES = 0,
+    INSTRUCTIONS,
+    L1D_MISSES,
+    LLC_MISSES,
+    BRANCH_MISSES,
+    DTLB_MISSES,
+    EVENT_COUNT
+  } Event;
+
+  // Counts from one start()/stop() interval; events that were not counted are not valid
+  struct Sample {
+    std::array<uint64_t, EVENT_COUNT> values{};
+    std::array<bool, EVENT_COUNT> valid{};
+
+    // Sums the counts of events valid in both, or takes other's if this is empty
+    auto operator+=(const Sample& other) -> Sample&;
+    [[nodiscard]] auto empty() const -> bool;
+  };
+
+  static auto name(Event event) -> std::string_view;
+  // Whether BENCHMARK_PERF_COUNTERS asks for counters
+  static auto requested() -> bool;
+
+  PerfCounters();
+  ~PerfCounters();
+  PerfCounters(const PerfCounters&) = delete;
+  PerfCounters& operator=(const PerfCounters&) = delete;
+
+  [[nodiscard]] auto is_available() const -> bool;
+  [[nodiscard]] auto get_error() const -> const std::string&;
+
+  auto start() -> void;
+  auto stop() -> Sample;
+
+ protected:
+  static constexpr size_t GROUP_SIZE = 3;
+
+  struct Group {
+    int leader = -1;
+    std::vector<Event> events;  // in the order the kernel reports them
+  };
+
+  auto open_event(Event event, Group& group) -> bool;
+
+  std::vector<Group> _groups;
+  std::vector<int> _fds;
+  std::string _error;
+};
@@ -0,0 +1,58 @@
+#pragma once
+#include <array>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "inference/static_network.hpp"
+
+/*  A whole network with its shape fixed at compile time: Inputs -> Layers hidden layers of
+    Hidden neurons -> Outputs. It is the first layer as a StaticBlock followed by the
+    StaticTail NeuralNetwork runs, so tests and benchmarks can check and time the unrolled
+    kernels against the dynamic network from raw inputs.
+*/
+template <size_t Inputs, size_t Hidden, size_t Layers, size_t Outputs, typename Activation>
+class StaticNetwork {
+ public:
+  typedef Neuron::Value Value;
+  typedef std::vector<Neuron> Layer;
+  typedef Inference::StaticTail<Hidden, Layers, Outputs, Activation> Tail;
+
+  static constexpr size_t INPUTS = Inputs;
+  static constexpr size_t OUTPUTS = Outputs;
+
+  static auto matches(size_t inputs, const std::vector<Layer>& hidden, const Layer& output)
+      -> bool {
+    if (inputs != Inputs || !Tail::matches(hidden, output)) {
+      return false;
+    }
+    for (const Neuron& neuron : hidden[0]) {
+      if (neuron.get_input_count() != Inputs) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  auto load(const std::vector<Layer>& hidden, const Layer& output) -> void {
+    if (!matches(Inputs, hidden, output)) {
+      throw std::invalid_argument("Network topology does not match the static network shape");
+    }
+    _first.load(hidden[0]);
+    _tail.load(hidden, output);
+  }
+
+  auto compute(std::span<const Value> inputs, std::span<Value> outputs) const -> void {
+    Tail::check_size(inputs.size(), Inputs);
+    std::array<Value, Hidden> activations;
+    _first.forward(inputs.data(), activations.data());
+    _tail.propagate(activations, outputs);
+  }
+
+ protected:
+  Inference::StaticBlock<Inputs, Hidden, Activation> _first;
+  Tail _tail;
+};
+
+// The production brain: 100 sensing cells, two hidden layers of 16, velocity x/y
+typedef StaticNetwork<100, 16, 2, 2, Inference::TanhActivation> ProductionNetwork;
@@ -1,8 +1,10 @@
 #pragma once
 
 #include <memory>
+#include <population.hpp>
 #include <texture_cache.hpp>
 #include <ui/state.hpp>
+#include <vector>
 
 class Game;
 
@@ -14,9 +16,17 @@ class FitnessDisplay {
   auto draw() -> void;
   auto set_mean(double mean) -> void;
   auto get_mean() -> double;
+  // Charts of the population's whole history; each plot asks for about one point per pixel
+  // of what is in view, so zooming out over a long run costs no more than zooming in
+  auto draw_history(const Population& population) -> void;
 
  protected:
+  auto plot_series(const char* label, const Population::History& history) -> void;
+
   double _mean;
+  // Follow the latest sample instead of keeping the user's zoom
+  bool _follow = true;
+  std::vector<Population::History::Point> _points;
 };
 }  // namespace Menu
 }  // namespace UI
\ No newline at end of file
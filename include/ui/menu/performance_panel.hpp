@@ -0,0 +1,86 @@
+#pragma once
+
+#include <array>
+#include <containers/spsc_ring.hpp>
+#include <cstdint>
+#include <optional>
+#include <ui/state.hpp>
+#include <util/tick_profile.hpp>
+#include <vector>
+#include <world.hpp>
+
+namespace UI {
+namespace Menu {
+
+/*  Rolling plots of where each frame's time goes, toggled with F3.
+
+    The game publishes one Frame per frame through a lock-free ring and update() drains it
+    into the plotted history, so the panel never holds up the simulation: if the panel falls
+    behind, frames are dropped from the ring instead. The last HISTORY frames are plotted.
+    Heap footprints walk the whole world, so only some frames carry one and the panel shows
+    the latest, per subsystem and per ant, genome and piece of food. Allocations per frame are
+    only shown when the game is built with NEURAL_ANTS_COUNT_ALLOCATIONS=ON (see
+    Util::AllocationCounter); otherwise the panel says they are not counted.
+*/
+class PerformancePanel {
+ public:
+  struct Frame {
+    double seconds = 0.0;  // wall time since the previous frame started
+    double simulationSeconds = 0.0;
+    double renderSeconds = 0.0;
+    double uiSeconds = 0.0;
+    std::array<double, Util::TickProfile::PHASE_COUNT> phaseSeconds{};
+    uint64_t ticks = 0;
+    uint64_t antsUpdated = 0;
+    uint64_t forwardPasses = 0;
+    uint64_t allocations = 0;
+    double poolUtilization = 0.0;  // share of the thread pool's time spent in its arena
+    bool hasMemory = false;
+    World::MemoryReport memory;
+  };
+
+  static constexpr size_t HISTORY = 600;  // ten seconds at 60 FPS
+  static constexpr size_t FEED_CAPACITY = 256;
+
+  PerformancePanel(UI::State& state);
+
+  // Producer side; false when the frame was dropped because the ring is full
+  auto publish(const Frame& frame) -> bool;
+  // Consumer side; moves published frames into the history whether or not the panel is shown
+  auto update() -> void;
+  auto draw() -> void;
+
+ protected:
+  typedef enum Series {
+    FRAME_MS = 0,
+    SIMULATION_MS,
+    RENDER_MS,
+    UI_MS,
+    PRESENT_MS,  // the rest of the frame: swapping buffers and waiting for vsync
+    ANTS_PER_SECOND,
+    FORWARD_PASSES_PER_SECOND,
+    ALLOCATIONS,
+    POOL_PERCENT,
+    HEAP_MIB,  // holds the latest footprint between frames that carry one
+    PHASE_MS,  // first of PHASE_COUNT per-phase series
+    SERIES_COUNT = PHASE_MS + Util::TickProfile::PHASE_COUNT
+  } Series;
+
+  auto record(const Frame& frame) -> void;
+  auto latest(size_t series) const -> float;
+  auto plot_line(const char* label, size_t series) const -> void;
+  auto draw_memory() const -> void;
+
+  UI::State& _state;
+  Containers::SpscRing<Frame, FEED_CAPACITY> _feed;
+  // Each series is a circular buffer; _next is the oldest value once _count reaches HISTORY
+  std::array<std::vector<float>, SERIES_COUNT> _series;
+  size_t _next = 0;
+  size_t _count = 0;
+  uint64_t _frames = 0;
+  uint64_t _ticks = 0;
+  std::optional<World::MemoryReport> _memory;
+};
+
+}  // namespace Menu
+}  // namespace UI
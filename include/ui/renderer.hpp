@@ -5,6 +5,7 @@
 #include <functional>
 #include <optional>
 #include <ui/menu/fitness_display.hpp>
+#include <ui/menu/performance_panel.hpp>
 #include <ui/menu/save_load.hpp>
 #include <ui/menu/settings.hpp>
 #include <ui/state.hpp>
@@ -18,10 +19,13 @@ namespace UI {
 class Renderer {
  public:
   Renderer(Game& game, TextureCache& textureCache);
+  ~Renderer();
   auto draw(float deltaTime) -> void;
   auto paused() const -> bool;
   auto pause() -> void;
   auto unpause() -> void;
+  // Frame statistics are published here; F3 shows and hides the panel
+  auto get_performance_panel() -> UI::Menu::PerformancePanel&;
 
  protected:
   auto setup() -> void;
@@ -39,6 +43,7 @@ class Renderer {
   UI::Menu::Settings _settingsMenu;
   UI::Menu::SaveLoad _saveLoadMenu;
   UI::Menu::FitnessDisplay _fitnessDisplay;
+  UI::Menu::PerformancePanel _performancePanel;
   TextureCache &_textureCache;
   UI::State _state;
 };
@@ -6,7 +6,7 @@ namespace UI {
 
 class State {
  public:
-  typedef enum Component { SETTINGS, MEAN_FITNESS, SAVELOAD } Component;
+  typedef enum Component { SETTINGS, MEAN_FITNESS, SAVELOAD, PERFORMANCE } Component;
 
   State() = default;
   auto maximize(Component component) -> void;
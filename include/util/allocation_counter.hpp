@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Util {
+
+/*  Heap allocations made through the global operator new since the program started.
+
+    The counts only move when src/tests/helpers/allocation_hook.cpp is linked in. It replaces
+    the global operator new and delete with versions that record each allocation before
+    handing it to malloc. The unit tests and benchmarks always link it; the game links it only
+    when configured with -DNEURAL_ANTS_COUNT_ALLOCATIONS=ON, and otherwise keeps the standard
+    allocator with is_enabled() false. Recording is two relaxed atomic additions, cheap next to
+    the allocation itself.
+*/
+class AllocationCounter {
+ public:
+  struct Counts {
+    uint64_t allocations = 0;
+    uint64_t bytes = 0;
+
+    auto operator-(const Counts& earlier) const -> Counts {
+      return {allocations - earlier.allocations, bytes - earlier.bytes};
+    }
+    auto operator+=(const Counts& other) -> Counts& {
+      allocations += other.allocations;
+      bytes += other.bytes;
+      return *this;
+    }
+  };
+
+  [[nodiscard]] static auto get() -> Counts;
+  // Whether the counting operator new is linked in; without it get() stays zero
+  [[nodiscard]] static auto is_enabled() -> bool;
+
+  // Called by the counting operator new
+  static auto record(std::size_t size) -> void;
+  static auto enable() -> void;
+};
+
+}  // namespace Util
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace Util {
+
+/*  16-bit float storage for weights at rest.
+
+    FP16 is IEEE binary16: more mantissa (10 bits) but a range of only about +-65504.
+    BF16 is the top half of a binary32: the full float range with 7 mantissa bits.
+    Narrowing rounds to nearest even in both formats.
+
+    The bulk conversions use F16C (vcvtps2ph / vcvtph2ps) and AVX2 when the build targets
+    them and fall back to bit manipulation otherwise, so packed data is identical either way.
+*/
+typedef enum WeightFormat { FP32 = 0, FP16, BF16 } WeightFormat;
+typedef uint16_t Half;
+
+auto float_to_fp16(float value) -> Half;
+auto fp16_to_float(Half value) -> float;
+auto float_to_bf16(float value) -> Half;
+auto bf16_to_float(Half value) -> float;
+
+// out must be the same size as values; format must be FP16 or BF16
+auto narrow(std::span<const float> values, std::span<Half> out, WeightFormat format) -> void;
+auto widen(std::span<const Half> values, std::span<float> out, WeightFormat format) -> void;
+
+// Bytes one weight occupies in format
+auto weight_size(WeightFormat format) -> size_t;
+
+}  // namespace Util
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace Util {
+
+/*  Heap memory an object owns, followed through every container it holds.
+
+    Classes report it from memory_usage() const by adding their vectors' buffers and the usage
+    of members that own memory in turn. Bytes are the reserved capacity, since that is what the
+    allocator handed out, and allocations are the live blocks behind them. The object itself is
+    not included: whoever holds it counts it, as a vector counts the slots of its elements.
+    footprint() adds it for the cost of one standalone object.
+*/
+struct MemoryUsage {
+  size_t bytes = 0;
+  size_t allocations = 0;
+
+  auto operator+=(const MemoryUsage& other) -> MemoryUsage& {
+    bytes += other.bytes;
+    allocations += other.allocations;
+    return *this;
+  }
+  auto operator+(const MemoryUsage& other) const -> MemoryUsage {
+    MemoryUsage sum = *this;
+    return sum += other;
+  }
+  auto operator-(const MemoryUsage& part) const -> MemoryUsage {
+    return {bytes - part.bytes, allocations - part.allocations};
+  }
+
+  // The buffer of a vector whose elements own no memory of their own
+  template <typename T>
+  auto add(const std::vector<T>& vector) -> MemoryUsage& {
+    if (vector.capacity() > 0) {
+      bytes += vector.capacity() * sizeof(T);
+      ++allocations;
+    }
+    return *this;
+  }
+
+  // The buffer of a vector and the memory_usage() of each of its elements
+  template <typename T>
+  auto add_each(const std::vector<T>& vector) -> MemoryUsage& {
+    add(vector);
+    for (const T& element : vector) {
+      *this += element.memory_usage();
+    }
+    return *this;
+  }
+
+  // Everything one object costs: itself and what it owns
+  template <typename T>
+  static auto footprint(const T& object) -> MemoryUsage {
+    MemoryUsage usage = object.memory_usage();
+    usage.bytes += sizeof(T);
+    return usage;
+  }
+};
+
+}  // namespace Util
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <tbb/task_scheduler_observer.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace Util {
+
+/*  Time threads spend inside TBB's default arena, summed over threads.
+
+    A thread's time is added when it leaves the arena. TBB workers spin for a while before they
+    leave, so this is an upper bound on the time spent running tasks; divided by wall time and
+    get_concurrency() it gives the pool's utilization.
+*/
+class ThreadPoolMonitor : public tbb::task_scheduler_observer {
+ public:
+  ThreadPoolMonitor();
+  ~ThreadPoolMonitor() override;
+  ThreadPoolMonitor(const ThreadPoolMonitor&) = delete;
+  ThreadPoolMonitor& operator=(const ThreadPoolMonitor&) = delete;
+
+  [[nodiscard]] auto get_busy_seconds() const -> double;
+  // Threads the default arena runs at once
+  [[nodiscard]] static auto get_concurrency() -> size_t;
+
+  auto on_scheduler_entry(bool worker) -> void override;
+  auto on_scheduler_exit(bool worker) -> void override;
+
+ protected:
+  std::atomic<uint64_t> _busyNanoseconds{0};
+};
+
+}  // namespace Util
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <numeric>
+#include <string_view>
+#include <util/allocation_counter.hpp>
+
+namespace Util {
+
+/*  Wall time spent in each phase of a world tick, the heap allocations made during it, and
+    counts of the work it did.
+
+    World::update measures every phase exactly once per tick. Retiring runs alongside thinking
+    and moving, so its phase only records how long the tick then waits for it and for the
+    refill of the population, and allocations are counted program-wide, so those phases see
+    each other's. Setting the profile exclusive runs them one after another instead, which
+    gives every phase exactly its own allocations without changing the outcome of the tick.
+*/
+class TickProfile {
+ public:
+  typedef enum Phase {
+    RESPAWN_FOOD = 0,
+    RESOLVE_CONTACTS,
+    SENSE,
+    THINK,
+    MOVE,
+    RETIRE_BREED,
+    PHASE_COUNT
+  } Phase;
+  typedef enum Counter { ANTS_UPDATED = 0, FORWARD_PASSES, BIRTHS, COUNTER_COUNT } Counter;
+  typedef std::chrono::steady_clock Clock;
+
+  static constexpr auto name(Phase phase) -> std::string_view {
+    constexpr std::array<std::string_view, PHASE_COUNT> NAMES = {
+        "respawn food", "resolve contacts", "sense", "think", "move", "retire/breed"};
+    return phase < PHASE_COUNT ? NAMES[phase] : "unknown";
+  }
+
+  // Runs work and adds its wall time and the allocations made meanwhile to phase
+  template <typename Work>
+  auto measure(Phase phase, Work&& work) -> void {
+    const auto allocations = AllocationCounter::get();
+    const auto start = Clock::now();
+    work();
+    _seconds[phase] += std::chrono::duration<double>(Clock::now() - start).count();
+    _allocations[phase] += AllocationCounter::get() - allocations;
+  }
+
+  auto count(Counter counter, uint64_t amount) -> void { _counts[counter] += amount; }
+
+  // Clears the times and counts of the last tick; exclusivity is kept
+  auto reset() -> void {
+    _seconds.fill(0.0);
+    _allocations.fill({});
+    _counts.fill(0);
+  }
+
+  auto set_exclusive(bool exclusive) -> void { _exclusive = exclusive; }
+  [[nodiscard]] auto is_exclusive() const -> bool { return _exclusive; }
+
+  [[nodiscard]] auto get_seconds(Phase phase) const -> double { return _seconds[phase]; }
+  [[nodiscard]] auto get_total_seconds() const -> double {
+    return std::accumulate(_seconds.begin(), _seconds.end(), 0.0);
+  }
+  [[nodiscard]] auto get_allocations(Phase phase) const -> AllocationCounter::Counts {
+    return _allocations[phase];
+  }
+  [[nodiscard]] auto get_total_allocations() const -> AllocationCounter::Counts {
+    AllocationCounter::Counts total;
+    for (const auto& allocations : _allocations) {
+      total += allocations;
+    }
+    return total;
+  }
+  [[nodiscard]] auto get_count(Counter counter) const -> uint64_t { return _counts[counter]; }
+
+ protected:
+  std::array<double, PHASE_COUNT> _seconds{};
+  std::array<AllocationCounter::Counts, PHASE_COUNT> _allocations{};
+  std::array<uint64_t, COUNTER_COUNT> _counts{};
+  bool _exclusive = false;
+};
+
+}  // namespace Util
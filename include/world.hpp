@@ -3,12 +3,16 @@
 #include <raylib.h>
 
 #include <functional>
+#include <label_batch.hpp>
 #include <nlohmann/json.hpp>
 #include <optional>
 #include <population.hpp>
 #include <resources.hpp>
 #include <texture_cache.hpp>
 #include <surroundings.hpp>
+#include <util/half.hpp>
+#include <util/memory_usage.hpp>
+#include <util/tick_profile.hpp>
 
 class World {
  public:
@@ -32,13 +36,47 @@ class World {
   [[nodiscard]] auto get_resources() const -> const Resources&;
 
   [[nodiscard]] auto get_bounds() const -> const Rectangle&;
+  // Resizes the world and its spawn area; food and ants already placed keep their positions
+  auto set_bounds(const Rectangle& bounds) -> void;
 
   [[nodiscard]] auto get_spawn_bounds() const -> const Rectangle&;
   auto set_spawn_margin(float) -> void;
   [[nodiscard]] auto get_spawn_margin() const -> float;
 
+  // Precision of brains created from now on; existing ants keep theirs
+  auto set_inference_precision(NeuralNetwork::Precision precision) -> void;
+  [[nodiscard]] auto get_inference_precision() const -> NeuralNetwork::Precision;
+  // Magnitude below which brains created from now on skip weights; 0 keeps every weight
+  auto set_prune_threshold(float threshold) -> void;
+  [[nodiscard]] auto get_prune_threshold() const -> float;
+  // Storage of genome weights at rest in ants and the pangenome; brains always compute in float
+  auto set_weight_format(Util::WeightFormat format) -> void;
+  [[nodiscard]] auto get_weight_format() const -> Util::WeightFormat;
+
+  // One tick: respawn food, resolve contacts, then sense, think, move and retire/breed
   auto update(float time) -> void;
-  auto draw() -> void;
+  // Phase times, allocations and work counts of the last update()
+  [[nodiscard]] auto get_tick_profile() const -> const Util::TickProfile&;
+  // For setting how the next updates are profiled
+  [[nodiscard]] auto get_tick_profile() -> Util::TickProfile&;
+
+  // Deep heap usage of the subsystems, with the counts that turn them into per-object costs
+  struct MemoryReport {
+    Util::MemoryUsage ants;       // see Population::get_ants_memory_usage()
+    Util::MemoryUsage pangenome;
+    Util::MemoryUsage resources;  // the food, its index and contact buffers
+    Util::MemoryUsage history;    // the population's chart histories
+    Util::MemoryUsage total;      // the whole world, histories and label buffers included
+    size_t antCount = 0;
+    size_t genomeCount = 0;
+    size_t foodCount = 0;
+  };
+  [[nodiscard]] auto memory_usage() const -> Util::MemoryUsage;
+  // Walks every ant and genome, so it is for sampling now and then rather than every frame
+  [[nodiscard]] auto get_memory_report() const -> MemoryReport;
+
+  // Draws only what camera can see, with less detail the further it is zoomed out
+  auto draw(const Camera2D& camera) -> void;
 
   [[nodiscard]] auto out_of_bounds(const Vector2& position) const -> bool;
 
@@ -52,6 +90,12 @@ class World {
   const Rectangle DEFAULT_BOUNDS = {0.0f, 0.0f, 1000.0f, 1000.0f};
   const float DEFAULT_SPAWN_MARGIN = 0.20F;
 
+  // On-screen sizes in pixels below which sprites collapse to dots and labels are dropped
+  static constexpr float MIN_SPRITE_PIXELS = 6.0F;
+  static constexpr float MIN_LABEL_PIXELS = 8.0F;
+  // World units an ant's direction line and labels can reach beyond its position
+  static constexpr float DRAW_MARGIN = 64.0F;
+
   auto update_spawn_rect() -> void;
   Resources _resources;
   Population _population;
@@ -59,4 +103,9 @@ class World {
   Rectangle _spawnBounds;
   TextureCache& _textureCache;
   float _spawnMargin;
+  NeuralNetwork::Precision _inferencePrecision = NeuralNetwork::FLOAT;
+  Util::WeightFormat _weightFormat = Util::FP32;
+  float _pruneThreshold = 0.0F;
+  Util::TickProfile _tickProfile;
+  LabelBatch _labels{Ant::FONT_SIZE, Ant::FONT_SPACING};
 };
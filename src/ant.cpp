@@ -7,6 +7,7 @@
 
 #include <brain.hpp>
 #include <genome.hpp>
+#include <label_batch.hpp>
 #include <population.hpp>
 #include <resources.hpp>
 #include <texture_cache.hpp>
@@ -15,8 +16,24 @@
 
 const Rectangle Ant::BOUNDS = {0.0F, 0.0F, Ant::TEXTURE_WIDTH, Ant::TEXTURE_HEIGHT};
 
+namespace {
+// A brain for a copy of an ant, at the precision the world now asks for: one that kept only
+// its int8 weights is rebuilt from the genome once the world runs float brains again
+auto copy_brain(World& world, const Brain& brain, const Genome& genome) -> Brain {
+  const NeuralNetwork& network = brain.get_network();
+  if (network.has_float_weights() || world.get_inference_precision() == NeuralNetwork::INT8) {
+    return Brain(world, network);
+  }
+  return Brain(world, genome.to_network());
+}
+}  // namespace
+
 Ant::Ant(World& world, const Genome& genome)
-    : _world(world), _brain(world, genome.get_network()), _genome(genome) {}
+    : _world(world), _brain(world, genome.get_network()), _genome(genome) {
+  // A FLOAT brain holds the float weights it runs on and an INT8 one only its int8 copy, so the
+  // genome keeps them at rest, in the world's format, for breeding and saves
+  _genome.compact(world.get_weight_format());
+}
 
 auto Ant::operator=(const Ant& other) -> Ant& {
   if (this != &other) {
@@ -47,7 +64,7 @@ auto Ant::operator==(const Ant& other) const -> bool {
 Ant::Ant(const Ant& other)
     : _world(other._world),
       _genome(other._genome),
-      _brain(other._world, other._genome.get_network()) {
+      _brain(copy_brain(other._world, other._brain, other._genome)) {
   _position = other._position;
   _velocity = other._velocity;
   _dead = other._dead;
@@ -107,11 +124,30 @@ auto Ant::set_position(const Vector2& position) -> void {
 }
 
 auto Ant::update(float time) -> void {
+  sense(time);
+  think();
+  move(time);
+}
+
+auto Ant::sense(float time) -> void {
   update_energy(time);
   if (_dead) {
     return;  // he's not dead, he's just resting
   }
-  _velocity = _brain.update(time, _position);
+  _brain.sense(time, _position);
+}
+
+auto Ant::think() -> void {
+  if (_dead) {
+    return;
+  }
+  _velocity = _brain.think();
+}
+
+auto Ant::move(float time) -> void {
+  if (_dead) {
+    return;
+  }
   _lifeSpan += time;
   _position = Vector2Add(_position, Vector2Scale(_velocity, time));
   update_bounds();
@@ -170,10 +206,18 @@ auto Ant::get_velocity() const -> const Vector2& {
 
 Ant::~Ant() {}
 
-auto Ant::get_genome() const -> Genome {
+auto Ant::get_genome() const -> const Genome& {
   return _genome;
 }
 
+auto Ant::get_brain() const -> const Brain& {
+  return _brain;
+}
+
+auto Ant::memory_usage() const -> Util::MemoryUsage {
+  return _genome.memory_usage() + _brain.memory_usage();
+}
+
 auto Ant::to_json() const -> nlohmann::json {
   nlohmann::json j;
   j["position"] = Util::vector2_to_json(_position);
@@ -191,7 +235,9 @@ auto Ant::to_json() const -> nlohmann::json {
 }
 
 Ant::Ant(const nlohmann::json& json, World& world)
-    : _world(world), _genome(json.at("genome")), _brain(world, _genome.get_network()) {
+    : _world(world), _genome(json.at("genome")), _brain(world, _genome.to_network()) {
+  // Saved genomes come in whatever format they were written with; keep them in the world's
+  _genome.compact(world.get_weight_format());
   _position = Util::vector2_from_json(json.at("position"));
   _velocity = Util::vector2_from_json(json.at("velocity"));
   _bounds = Util::rectangle_from_json(json.at("bounds"));
@@ -214,16 +260,24 @@ auto Ant::set_texture_index(size_t index) -> void {
 }
 
 // Drawing methods
-auto Ant::draw(TextureCache& texture_cache) const -> void {
+auto Ant::draw(TextureCache& texture_cache, LabelBatch& labels, Detail detail) const -> void {
   if (_dead) {
     return;
   }
 
+  if (detail == DOT) {
+    draw_dot();
+    return;
+  }
+
   draw_body(texture_cache);
+  if (detail == BODY) {
+    return;
+  }
+
   draw_direction();
   draw_bounding();
-  draw_energy();
-  draw_coordinates();
+  draw_coordinates(labels);
 }
 
 auto Ant::draw_body(TextureCache& texture_cache) const -> void {
@@ -238,8 +292,13 @@ auto Ant::draw_body(TextureCache& texture_cache) const -> void {
   DrawTexturePro(texture, source, dest, origin, get_rotation(), WHITE);
 }
 
-auto Ant::draw_energy() const -> void {
-  const auto textRect = get_coordinates_rect();
+auto Ant::draw_dot() const -> void {
+  // A plain quad keeps zoomed out frames in the shape batch instead of switching textures
+  const Rectangle dot = {_position.x - RADIUS / 2.0F, _position.y - RADIUS / 2.0F, RADIUS, RADIUS};
+  DrawRectangleRec(dot, BLACK);
+}
+
+auto Ant::draw_energy(const Rectangle& textRect) const -> void {
   const int lineX = static_cast<int>(std::round(textRect.x));
 
   float energyPercentage = _energy / STARTING_ENERGY;
@@ -263,12 +322,14 @@ auto Ant::draw_energy() const -> void {
   DrawRectangle(lineX, lineY, lineLength, lineHeight, lineColor);
 }
 
-auto Ant::draw_coordinates() const -> void {
-  const auto& position = get_position();
-  const std::string text = fmt::format("({:.2f}, {:.2f})", position.x, position.y);
-  const auto coordinatesRect = get_coordinates_rect();
+auto Ant::draw_coordinates(LabelBatch& labels) const -> void {
+  LabelBatch::Buffer buffer;
+  const auto text = LabelBatch::format_coordinates(get_position(), buffer);
+  const auto coordinatesRect = get_coordinates_rect(labels, text);
 
-  DrawText(text.c_str(), coordinatesRect.x, coordinatesRect.y, FONT_SIZE, BLACK);
+  // The energy bar sits behind the text, so it is drawn now and the text queued for later
+  draw_energy(coordinatesRect);
+  labels.add({coordinatesRect.x, coordinatesRect.y}, text, BLACK);
 }
 
 auto Ant::draw_direction() const -> void {
@@ -294,11 +355,10 @@ auto Ant::draw_bounding() const -> void {
   DrawPixelV(position, color);
 }
 
-auto Ant::get_coordinates_rect() const -> Rectangle {
+auto Ant::get_coordinates_rect(LabelBatch& labels, std::string_view text) const -> Rectangle {
   const auto& position = get_position();
-  const std::string text = fmt::format("({:.2f}, {:.2f})", position.x, position.y);
 
-  Vector2 textSize = MeasureTextEx(GetFontDefault(), text.c_str(), FONT_SIZE, FONT_SPACING);
+  Vector2 textSize = labels.measure(text);
   int textX = static_cast<int>((position.x) + 1.5F - (textSize.x / 2.0F));
   int textY = static_cast<int>(((position.y) - (textSize.y / 2.0f + 20)));
 
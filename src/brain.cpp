@@ -14,6 +14,12 @@
 Brain::Brain(World& world, const NeuralNetwork& neuralNetwork)
     : _world(world), _neuralNetwork(neuralNetwork) {
   _surroundings.set_dimensions(TILES_COUNT, TILES_COUNT);
+  _neuralNetwork.set_precision(world.get_inference_precision());
+  _neuralNetwork.set_prune_threshold(world.get_prune_threshold());
+  // INT8 brains run on their int8 copy alone; the ant's genome keeps the float weights
+  if (_neuralNetwork.get_precision() == NeuralNetwork::INT8) {
+    _neuralNetwork.release_float_weights();
+  }
 }
 
 auto Brain::operator=(const Brain& other) -> Brain& {
@@ -21,13 +27,17 @@ auto Brain::operator=(const Brain& other) -> Brain& {
     _world = other._world;
     _surroundings = other._surroundings;
     _neuralNetwork = other._neuralNetwork;
-    _surroundings_encoded = other._surroundings_encoded;
     _last_update = other._last_update;
   }
   return *this;
 }
 
 auto Brain::update(float time, Vector2 position) -> Vector2 {
+  sense(time, position);
+  return think();
+}
+
+auto Brain::sense(float time, Vector2 position) -> void {
   _last_update += time;
   if (_last_update >= UPDATE_FREQUENCY) {
     _last_update -= UPDATE_FREQUENCY;
@@ -35,25 +45,16 @@ auto Brain::update(float time, Vector2 position) -> Vector2 {
     update_surroundings(position);
   }
 
-  // Only update the network inputs if the surroundings have changed
+  // Only update the network inputs if the surroundings have changed; the food and wall
+  // masks feed the network's ternary first layer directly
   if (_surroundings.changed()) {
-    const auto& far = _surroundings.get_encoded_surroundings();
-
-    // Sanity checks for corrupted sizes
-    size_t farSize = far.size();
-    const size_t MAX_REASONABLE_SIZE = 1000000;  // 1M elements max
-    if (farSize > MAX_REASONABLE_SIZE) {
-      throw std::runtime_error("Far surroundings size is suspiciously large: " +
-                               std::to_string(farSize) + " (expected ~100)");
-    }
-
-    _surroundings_encoded.resize(farSize);
-    std::ranges::copy(far, _surroundings_encoded.begin());
-
-    _neuralNetwork.set_input_values(_surroundings_encoded);
+    _neuralNetwork.set_input_masks(_surroundings.get_food_mask(), _surroundings.get_wall_mask());
+    _surroundings.clear_changed();
   }
+}
 
-  const auto& outputs = _neuralNetwork.get_output_values();
+auto Brain::think() -> Vector2 {
+  const auto outputs = _neuralNetwork.get_output_values();
   if (outputs.empty()) {
     throw std::runtime_error("Neural network outputs are empty");
   }
@@ -67,29 +68,39 @@ auto Brain::update(float time, Vector2 position) -> Vector2 {
   return velocity;
 }
 
+auto Brain::get_network() const -> const NeuralNetwork& {
+  return _neuralNetwork;
+}
+
+auto Brain::memory_usage() const -> Util::MemoryUsage {
+  return _surroundings.memory_usage() + _neuralNetwork.memory_usage();
+}
+
 auto Brain::update_surroundings(Vector2 position) -> void {
   size_t center = _surroundings.get_height() / 2;  // center is the center x/y tile
+  const Rectangle& bounds = _world.get().get_bounds();
+  const Resources& resources = _world.get().get_resources();
   Rectangle rect;
   rect.height = TILES_SIZE;
   rect.width = TILES_SIZE;
-  rect.x = position.x;
-  rect.y = position.y;
-  for (size_t x = 0; x < _surroundings.get_width(); ++x) {
-    float x_rel = static_cast<float>(x) - static_cast<float>(center);
+  for (size_t y = 0; y < _surroundings.get_height(); ++y) {
+    // calculate the aabb row for this tile and write it as one pair of masks
+    float y_rel = static_cast<float>(y) - static_cast<float>(center);
+    rect.y = position.y + y_rel * TILES_SIZE;
 
-    for (size_t y = 0; y < _surroundings.get_height(); ++y) {
-      // calculate the aabb for this tile
-      float y_rel = static_cast<float>(y) - static_cast<float>(center);
+    Surroundings::Mask food = 0;
+    Surroundings::Mask wall = 0;
+    for (size_t x = 0; x < _surroundings.get_width(); ++x) {
+      float x_rel = static_cast<float>(x) - static_cast<float>(center);
       rect.x = position.x + x_rel * TILES_SIZE;
-      rect.y = position.y + y_rel * TILES_SIZE;
 
-      if (!IsRectContained(rect, _world.get().get_bounds())) {
-        _surroundings.set_type(x, y, Surroundings::WALL);
-      } else if (_world.get().get_resources().food_in_rect(rect)) {
-        _surroundings.set_type(x, y, Surroundings::FOOD);
-      } else {
-        _surroundings.set_type(x, y, Surroundings::EMPTY);
+      const Surroundings::Mask bit = Surroundings::Mask{1} << x;
+      if (!IsRectContained(rect, bounds)) {
+        wall |= bit;
+      } else if (resources.food_in_rect(rect)) {
+        food |= bit;
       }
     }
+    _surroundings.set_row(y, food, wall);
   }
 }
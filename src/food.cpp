@@ -64,6 +64,14 @@ auto Food::draw() const -> void {
   DrawTexturePro(texture, source, dest, origin, 0.0F, WHITE);
 }
 
+auto Food::draw_dot() const -> void {
+  if (_eaten)
+    return;
+
+  const Rectangle dot = {_position.x - RADIUS / 2.0F, _position.y - RADIUS / 2.0F, RADIUS, RADIUS};
+  DrawRectangleRec(dot, RED);
+}
+
 auto Food::eat(Ant& ant) -> void {
   if (_eaten)
     return;
@@ -15,15 +15,25 @@ Game::Game() : _world(_textureCache), _ui(*this, _textureCache), _input(*this),
   _world.get_resources().set_food_count(50);  // Reduced from 200 for stronger selection pressure
 }
 
+namespace {
+auto seconds_since(std::chrono::steady_clock::time_point start) -> double {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+}  // namespace
+
 auto Game::run() -> void {
   if (!_raylibInitialized) {
     initialize_raylib();
   }
 
   bool texturesLoaded = false;
+  _frameStart = std::chrono::steady_clock::now();
+  _frameAllocations = Util::AllocationCounter::get();
+  _frameBusySeconds = _threadPoolMonitor.get_busy_seconds();
 
   while (!WindowShouldClose()) {
     float time = GetFrameTime();
+    UI::Menu::PerformancePanel::Frame frame;
     BeginDrawing();
     if (!texturesLoaded) {
       load_textures();
@@ -34,9 +44,19 @@ auto Game::run() -> void {
 
     if (!_ui.paused()) {
       _input.update(time);  // Move outside loop - only once per frame
+      const auto simulationStart = std::chrono::steady_clock::now();
       for (auto count = 0; count < _updateSpeed; ++count) {
         _world.update(time);  // Only world simulation repeats
+        const auto& profile = _world.get_tick_profile();
+        for (size_t phase = 0; phase < Util::TickProfile::PHASE_COUNT; ++phase) {
+          frame.phaseSeconds[phase] +=
+              profile.get_seconds(static_cast<Util::TickProfile::Phase>(phase));
+        }
+        frame.antsUpdated += profile.get_count(Util::TickProfile::ANTS_UPDATED);
+        frame.forwardPasses += profile.get_count(Util::TickProfile::FORWARD_PASSES);
+        ++frame.ticks;
       }
+      frame.simulationSeconds = seconds_since(simulationStart);
     }
 
     // Monitor FPS and reduce speed if it drops below 10 FPS
@@ -53,17 +73,49 @@ auto Game::run() -> void {
       _lastSpeedAdjustmentTime = currentTime;
     }
 
+    const auto renderStart = std::chrono::steady_clock::now();
     ClearBackground(BLACK);
-    _world.draw();
+    _world.draw(_camera);
     EndMode2D();
+    frame.renderSeconds = seconds_since(renderStart);
+
+    const auto uiStart = std::chrono::steady_clock::now();
     _ui.draw(time);
+    frame.uiSeconds = seconds_since(uiStart);
 
     EndDrawing();
+    publish_frame(frame);
   }
 
   CloseWindow();
 }
 
+auto Game::publish_frame(UI::Menu::PerformancePanel::Frame& frame) -> void {
+  const auto now = std::chrono::steady_clock::now();
+  frame.seconds = std::chrono::duration<double>(now - _frameStart).count();
+  _frameStart = now;
+
+  const auto allocations = Util::AllocationCounter::get();
+  frame.allocations = (allocations - _frameAllocations).allocations;
+  _frameAllocations = allocations;
+
+  // Share of the pool's thread-seconds this frame that were spent inside its arena
+  const double busySeconds = _threadPoolMonitor.get_busy_seconds();
+  const double capacity =
+      frame.seconds * static_cast<double>(Util::ThreadPoolMonitor::get_concurrency());
+  frame.poolUtilization = capacity > 0.0 ? (busySeconds - _frameBusySeconds) / capacity : 0.0;
+  _frameBusySeconds = busySeconds;
+
+  // Taken after the frame was timed, so the walk shows up in the next frame's present time
+  if (std::chrono::duration<double>(now - _lastMemoryReport).count() >= MEMORY_REPORT_SECONDS) {
+    frame.memory = _world.get_memory_report();
+    frame.hasMemory = true;
+    _lastMemoryReport = now;
+  }
+
+  _ui.get_performance_panel().publish(frame);
+}
+
 auto Game::get_camera() const -> const Camera2D& {
   return _camera;
 }
@@ -1,29 +1,72 @@
 #include "genome.hpp"
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
 #include "neural_network.hpp"
 #include "neuron.hpp"
 
+namespace {
+// Network without layers that a compact genome holds in place of its float layers
+auto empty_network() -> const NeuralNetwork& {
+  static const NeuralNetwork empty = [] {
+    NeuralNetwork network;
+    network.set_hidden_layer_count(0);
+    network.set_output_neuron_count(0);
+    network.set_input_count(0);
+    return network;
+  }();
+  return empty;
+}
+
+// One parent neuron as breeding reads it
+struct ParentParameters {
+  Neuron::Value bias;
+  std::span<const Neuron::Value> weights;
+};
+}  // namespace
+
 Genome::Genome(const Genome& other)
     : _network(other._network),
+      _weightFormat(other._weightFormat),
+      _packedShape(other._packedShape),
+      _packedWeights(other._packedWeights),
       _mutationRate(other._mutationRate),
       _fitness(other._fitness),
       _childrenCount(other._childrenCount) {}
 
 Genome::Genome(Genome&& other) noexcept
     : _network(std::move(other._network)),
+      _weightFormat(other._weightFormat),
+      _packedShape(other._packedShape),
+      _packedWeights(std::move(other._packedWeights)),
       _mutationRate(other._mutationRate),
       _fitness(other._fitness),
       _childrenCount(other._childrenCount) {}
 
 Genome::Genome(const nlohmann::json& json)
-    : _network(json.at("network")),
+    : _network(json.contains("network") ? NeuralNetwork(json.at("network"))
+                                        : NeuralNetwork(empty_network())),
       _mutationRate(json.at("mutation_rate").get<double>()),
       _fitness(json.at("fitness").get<double>()),
-      _childrenCount(json.at("children_count").get<size_t>()) {}
+      _childrenCount(json.at("children_count").get<size_t>()) {
+  if (json.contains("packed_network")) {
+    load_packed_network(json.at("packed_network"));
+  }
+}
 
 auto Genome::operator=(const Genome& other) -> Genome& {
   if (this != &other) {
     _network = other._network;
+    _weightFormat = other._weightFormat;
+    _packedShape = other._packedShape;
+    _packedWeights = other._packedWeights;
     _mutationRate = other._mutationRate;
     _fitness = other._fitness;
     _childrenCount = other._childrenCount;
@@ -34,6 +77,9 @@ auto Genome::operator=(const Genome& other) -> Genome& {
 auto Genome::operator=(Genome&& other) noexcept -> Genome& {
   if (this != &other) {
     _network = std::move(other._network);
+    _weightFormat = other._weightFormat;
+    _packedShape = other._packedShape;
+    _packedWeights = std::move(other._packedWeights);
     _mutationRate = other._mutationRate;
     _fitness = other._fitness;
     _childrenCount = other._childrenCount;
@@ -42,89 +88,230 @@ auto Genome::operator=(Genome&& other) noexcept -> Genome& {
 }
 
 auto Genome::operator==(const Genome& other) const -> bool {
-  return _network == other._network && _mutationRate == other._mutationRate &&
+  return _network == other._network && _weightFormat == other._weightFormat &&
+         _packedShape == other._packedShape && _packedWeights == other._packedWeights &&
+         _mutationRate == other._mutationRate &&
          _fitness == other._fitness && _childrenCount == other._childrenCount;
 }
 
 auto Genome::get_network() const -> const NeuralNetwork& {
+  if (is_compact()) {
+    throw std::logic_error("Genome weights are compact; expand() the genome first");
+  }
   return _network;
 }
 
-auto Genome::breed_neuron(const Neuron& parentNeuron, Neuron& childNeuron) -> void {
-  for (size_t weightIdx = 0; weightIdx < parentNeuron.get_input_count(); ++weightIdx) {
-    if (_rng.coin_flip()) {
-      childNeuron.set_input_weight(weightIdx, parentNeuron.get_input_weight(weightIdx));
-    }
+auto Genome::to_network() const -> NeuralNetwork {
+  if (!is_compact()) {
+    return _network;
   }
+  Genome expanded = *this;
+  expanded.expand();
+  return std::move(expanded._network);
+}
 
-  if (_rng.coin_flip()) {
-    childNeuron.set_bias(parentNeuron.get_bias());
+auto Genome::compact(Util::WeightFormat format) -> void {
+  if (format == _weightFormat) {
+    return;
+  }
+  expand();
+  if (format == Util::FP32) {
+    return;
   }
+
+  _packedShape = {_network.get_input_count(),
+                  _network.get_hidden_layer_count(),
+                  _network.get_hidden_layer_neuron_count(),
+                  _network.get_output_neuron_count()};
+  std::vector<Neuron::Value> parameters(_network.get_parameter_count());
+  _network.get_parameters(parameters);
+  _packedWeights.resize(parameters.size());
+  Util::narrow(parameters, _packedWeights, format);
+
+  // Move from a fresh copy so the float layers' storage is actually released
+  _network = NeuralNetwork(empty_network());
+  _weightFormat = format;
 }
 
-auto Genome::breed_layer(const NeuralNetwork::Layer& parent1, NeuralNetwork::Layer& child) -> void {
-  for (size_t neuronIdx = 0; neuronIdx < parent1.size(); ++neuronIdx) {
-    const Neuron& parent1Neuron = parent1[neuronIdx];
-    Neuron& childNeuron = child[neuronIdx];
-    breed_neuron(parent1Neuron, childNeuron);
+auto Genome::expand() -> void {
+  if (!is_compact()) {
+    return;
   }
+
+  NeuralNetwork network;
+  network.set_input_count(_packedShape.inputs);
+  network.set_hidden_layer_neuron_count(_packedShape.hiddenNeurons);
+  network.set_hidden_layer_count(_packedShape.hiddenLayers);
+  network.set_output_neuron_count(_packedShape.outputs);
+
+  std::vector<Neuron::Value> parameters(_packedWeights.size());
+  Util::widen(_packedWeights, parameters, _weightFormat);
+  network.set_parameters(parameters);
+
+  _network = std::move(network);
+  _packedWeights = {};
+  _packedShape = {};
+  _weightFormat = Util::FP32;
 }
 
-auto Genome::mutate_neuron(Neuron& neuron) {
-  if (should_mutate()) {
-    neuron.set_bias(neuron.get_bias() + mutation_amount());
-  }
-  for (size_t index = 0; index < neuron.get_input_count(); ++index) {
-    if (should_mutate()) {
-      neuron.set_input_weight(index, neuron.get_input_weight(index) + mutation_amount());
-    }
-  }
+auto Genome::is_compact() const -> bool {
+  return _weightFormat != Util::FP32;
+}
+
+auto Genome::get_weight_format() const -> Util::WeightFormat {
+  return _weightFormat;
 }
 
-auto Genome::mutate_layer(NeuralNetwork::Layer& layer) {
-  for (Neuron& neuron : layer) {
-    mutate_neuron(neuron);
+auto Genome::get_weight_bytes() const -> size_t {
+  if (is_compact()) {
+    return _packedWeights.size() * sizeof(Util::Half);
   }
+  return _network.get_parameter_count() * sizeof(Neuron::Value);
+}
+
+auto Genome::memory_usage() const -> Util::MemoryUsage {
+  return _network.memory_usage() + Util::MemoryUsage{}.add(_packedWeights);
 }
 
-auto Genome::breed_network(NeuralNetwork& childNetwork) -> void {
-  // Breed hidden layers
-  for (size_t layerIdx = 0; layerIdx < _network.get_hidden_layer_count(); ++layerIdx) {
-    auto layer = childNetwork.get_hidden_layer(layerIdx);
-    breed_layer(_network.get_hidden_layer(layerIdx), layer);
-    childNetwork.set_hidden_layer(layerIdx, layer);
+auto Genome::crossover(std::span<const Neuron::Value> parent,
+                       std::span<Neuron::Value> child,
+                       RandomGenerator& rng) -> void {
+  for (size_t block = 0; block < child.size(); block += 64) {
+    const uint64_t mask = rng.bits();
+    const size_t count = std::min<size_t>(64, child.size() - block);
+    const Neuron::Value* from = parent.data() + block;
+    Neuron::Value* to = child.data() + block;
+    size_t index = 0;
+#if defined(__AVX512F__)
+    for (; index + 16 <= count; index += 16) {
+      const auto lanes = static_cast<__mmask16>(mask >> index);
+      _mm512_mask_storeu_ps(to + index, lanes, _mm512_loadu_ps(from + index));
+    }
+#elif defined(__AVX2__)
+    const __m256i laneBits = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+    for (; index + 8 <= count; index += 8) {
+      const __m256i byte = _mm256_set1_epi32(static_cast<int>((mask >> index) & 0xFFU));
+      const __m256 lanes =
+          _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(byte, laneBits), laneBits));
+      const __m256 blended =
+          _mm256_blendv_ps(_mm256_loadu_ps(to + index), _mm256_loadu_ps(from + index), lanes);
+      _mm256_storeu_ps(to + index, blended);
+    }
+#endif
+    for (; index < count; ++index) {
+      if ((mask >> index) & 1U) {
+        to[index] = from[index];
+      }
+    }
   }
+}
+
+template <typename ParentNeuron>
+auto Genome::breed_network(ParentNeuron&& parent,
+                           NeuralNetwork& childNetwork,
+                           RandomGenerator& rng) -> void {
+  uint64_t biasMask = 0;
+  size_t biasBits = 0;
+  childNetwork.edit_neurons([&](size_t layerIndex, size_t neuronIndex, Neuron& child) {
+    const ParentParameters from = parent(layerIndex, neuronIndex, child);
+    crossover(from.weights, child.get_weights(), rng);
 
-  auto layer = childNetwork.get_output_layer();
-  breed_layer(_network.get_output_layer(), layer);
-  childNetwork.set_output_layer(layer);
+    if (biasBits == 0) {
+      biasMask = rng.bits();
+      biasBits = 64;
+    }
+    if (biasMask & 1U) {
+      child.set_bias(from.bias);
+    }
+    biasMask >>= 1;
+    --biasBits;
+  });
 }
 
-auto Genome::breed_with(const Genome& other) -> Genome {
-  Genome child = other;  // child's genome begins as a clone of parent2 which simplifies later logic
-  breed_network(child._network);
+auto Genome::breed_with(const Genome& other, RandomGenerator& rng) const -> Genome {
+  // child's genome begins as a clone of parent2 which simplifies later logic
+  Genome child = other;
+  child.expand();
+  // Reseeded so children of the same parent2 do not all mutate alike
+  child._rng = RandomGenerator(rng.bits());
+
+  if (is_compact()) {
+    // A compact parent is widened into a per-thread buffer that later births reuse, so it
+    // stays compact where it is stored and no temporary network is built. edit_neurons visits
+    // neurons in parameter order, so each one's bias and weights follow the previous one's
+    static thread_local std::vector<Neuron::Value> parameters;
+    parameters.resize(_packedWeights.size());
+    Util::widen(_packedWeights, parameters, _weightFormat);
+    size_t offset = 0;
+    breed_network(
+        [&](size_t, size_t, const Neuron& child) {
+          const ParentParameters from{
+              parameters[offset],
+              std::span<const Neuron::Value>(parameters).subspan(offset + 1,
+                                                                 child.get_input_count())};
+          offset += child.get_input_count() + 1;
+          return from;
+        },
+        child._network,
+        rng);
+  } else {
+    const size_t hiddenLayerCount = _network.get_hidden_layer_count();
+    breed_network(
+        [&](size_t layerIndex, size_t neuronIndex, const Neuron&) {
+          const Neuron& neuron = layerIndex < hiddenLayerCount
+                                     ? _network.get_hidden_layer(layerIndex)[neuronIndex]
+                                     : _network.get_output_layer()[neuronIndex];
+          return ParentParameters{neuron.get_bias(), neuron.get_weights()};
+        },
+        child._network,
+        rng);
+  }
   child.mutate();
   return child;
 }
 
 auto Genome::mutate() -> void {
-  for (size_t layerIdx = 0; layerIdx < _network.get_hidden_layer_count(); ++layerIdx) {
-    auto layer = _network.get_hidden_layer(layerIdx);
-    mutate_layer(layer);
-    _network.set_hidden_layer(layerIdx, layer);
+  expand();
+  if (_mutationRate <= 0.0) {
+    return;
   }
-  auto layer = _network.get_output_layer();
-  mutate_layer(layer);
-  _network.set_output_layer(layer);
+  // Position of the next mutation relative to the start of the current neuron; the bias is
+  // position 0 and the weights follow, matching NeuralNetwork::get_parameters
+  size_t next = mutation_gap();
+  _network.edit_neurons([&](size_t, size_t, Neuron& neuron) {
+    const size_t parameterCount = neuron.get_input_count() + 1;
+    if (next >= parameterCount) {
+      next -= parameterCount;
+      return;
+    }
+    const auto weights = neuron.get_weights();
+    for (; next < parameterCount; next += mutation_gap() + 1) {
+      if (next == 0) {
+        neuron.set_bias(neuron.get_bias() + mutation_amount());
+      } else {
+        weights[next - 1] += static_cast<Neuron::Value>(mutation_amount());
+      }
+    }
+    next -= parameterCount;
+  });
 }
 
 auto Genome::randomize() -> void {
+  expand();
   _network.randomize();
 }
 
-auto Genome::should_mutate() -> bool {
-  return (_rng.uniform(0.0, 1.0) < _mutationRate);
+auto Genome::mutation_gap() -> size_t {
+  if (_mutationRate >= 1.0) {
+    return 0;
+  }
+  // Inverse CDF of the geometric distribution; 1 - uniform() is in (0, 1] so the log is finite
+  const double gap = std::floor(std::log(1.0 - _rng.uniform()) / std::log1p(-_mutationRate));
+  return gap < static_cast<double>(std::numeric_limits<uint32_t>::max())
+             ? static_cast<size_t>(gap)
+             : std::numeric_limits<uint32_t>::max();
 }
+
 auto Genome::mutation_amount() -> double {
   return _rng.normal(0.0F, 0.1F);
 }
@@ -158,9 +345,37 @@ auto Genome::increment_children_count() -> void {
 
 auto Genome::to_json() const -> nlohmann::json {
   nlohmann::json j;
-  j["network"] = _network.to_json();
+  if (is_compact()) {
+    j["packed_network"] = packed_network_json();
+  } else {
+    j["network"] = _network.to_json();
+  }
   j["mutation_rate"] = _mutationRate;
   j["fitness"] = _fitness;
   j["children_count"] = _childrenCount;
   return j;
-}
\ No newline at end of file
+}
+
+auto Genome::packed_network_json() const -> nlohmann::json {
+  nlohmann::json j;
+  j["weight_format"] = _weightFormat;
+  j["input_count"] = _packedShape.inputs;
+  j["hidden_layer_count"] = _packedShape.hiddenLayers;
+  j["hidden_layer_neuron_count"] = _packedShape.hiddenNeurons;
+  j["output_neuron_count"] = _packedShape.outputs;
+  j["weights"] = _packedWeights;
+  return j;
+}
+
+auto Genome::load_packed_network(const nlohmann::json& json) -> void {
+  const auto format = json.at("weight_format").get<Util::WeightFormat>();
+  if (format == Util::FP32) {
+    throw std::invalid_argument("A packed network needs a 16-bit weight format");
+  }
+  _packedShape = {json.at("input_count").get<size_t>(),
+                  json.at("hidden_layer_count").get<size_t>(),
+                  json.at("hidden_layer_neuron_count").get<size_t>(),
+                  json.at("output_neuron_count").get<size_t>()};
+  _packedWeights = json.at("weights").get<std::vector<Util::Half>>();
+  _weightFormat = format;
+}
@@ -0,0 +1,78 @@
+#include "inference/output_cache.hpp"
+
+#include <algorithm>
+
+namespace Inference {
+
+auto OutputCache::hash(std::span<const Mask> positive, std::span<const Mask> negative)
+    -> size_t {
+  // splitmix64 finalizer folded over both masks
+  auto mix = [](uint64_t value) {
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+    return value ^ (value >> 31);
+  };
+  uint64_t hash = 0;
+  for (size_t word = 0; word < positive.size(); ++word) {
+    hash = mix(hash ^ positive[word]);
+    hash = mix(hash ^ negative[word]);
+  }
+  return static_cast<size_t>(hash);
+}
+
+auto OutputCache::matches(size_t slot,
+                          std::span<const Mask> positive,
+                          std::span<const Mask> negative) const -> bool {
+  const Mask* key = _keys.data() + slot * 2 * _maskCount;
+  return std::equal(positive.begin(), positive.end(), key) &&
+         std::equal(negative.begin(), negative.end(), key + _maskCount);
+}
+
+auto OutputCache::find(std::span<const Mask> positive, std::span<const Mask> negative)
+    -> std::span<const Neuron::Value> {
+  const size_t slot = hash(positive, negative) % SLOT_COUNT;
+  if (!_valid[slot] || positive.size() != _maskCount || negative.size() != _maskCount ||
+      !matches(slot, positive, negative)) {
+    ++_stats.misses;
+    return {};
+  }
+  ++_stats.hits;
+  return {_outputs.data() + slot * _outputCount, _outputCount};
+}
+
+auto OutputCache::insert(std::span<const Mask> positive,
+                         std::span<const Mask> negative,
+                         std::span<const Neuron::Value> outputs) -> void {
+  if (positive.size() != negative.size() || outputs.empty()) {
+    return;
+  }
+  if (positive.size() != _maskCount || outputs.size() != _outputCount) {
+    // First insert or the network changed shape; storage is only allocated here
+    _maskCount = positive.size();
+    _outputCount = outputs.size();
+    _keys.assign(SLOT_COUNT * 2 * _maskCount, 0);
+    _outputs.assign(SLOT_COUNT * _outputCount, 0.0F);
+    _valid.fill(false);
+  }
+
+  const size_t slot = hash(positive, negative) % SLOT_COUNT;
+  Mask* key = _keys.data() + slot * 2 * _maskCount;
+  std::ranges::copy(positive, key);
+  std::ranges::copy(negative, key + _maskCount);
+  std::ranges::copy(outputs, _outputs.begin() + static_cast<std::ptrdiff_t>(slot * _outputCount));
+  _valid[slot] = true;
+}
+
+auto OutputCache::clear() -> void {
+  _valid.fill(false);
+}
+
+auto OutputCache::get_stats() const -> const Stats& {
+  return _stats;
+}
+
+auto OutputCache::memory_usage() const -> Util::MemoryUsage {
+  return Util::MemoryUsage{}.add(_keys).add(_outputs);
+}
+
+}  // namespace Inference
@@ -0,0 +1,293 @@
+#include "inference/pruned_network.hpp"
+
+#if defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+#include <algorithm>
+#include <bit>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+
+namespace Inference {
+
+namespace {
+typedef BlockSparseLayer::BlockMask BlockMask;
+
+// lanes += scale * the packed weights expanded into the lanes set in mask
+auto expand_axpy(BlockMask mask,
+                 const Neuron::Value* packed,
+                 Neuron::Value scale,
+                 Neuron::Value* lanes) -> void {
+#if defined(__AVX512F__)
+  const __m512 weights = _mm512_maskz_expandloadu_ps(mask, packed);
+  _mm512_storeu_ps(lanes,
+                   _mm512_fmadd_ps(_mm512_set1_ps(scale), weights, _mm512_loadu_ps(lanes)));
+#else
+  for (; mask != 0; mask &= mask - 1) {
+    lanes[std::countr_zero(mask)] += scale * *packed++;
+  }
+#endif
+}
+}  // namespace
+
+auto BlockSparseLayer::build(std::span<const Neuron> layer,
+                             std::span<const uint32_t> neurons,
+                             std::span<const uint32_t> inputs,
+                             Neuron::Value threshold) -> void {
+  if (inputs.size() >= NO_SLOT) {
+    throw std::invalid_argument("Block sparse layers take at most " + std::to_string(NO_SLOT) +
+                                " inputs");
+  }
+  _inputCount = inputs.size();
+  _neuronCount = neurons.size();
+  _blockCount = (_neuronCount + BLOCK_SIZE - 1) / BLOCK_SIZE;
+  _slots.assign(_inputCount, NO_SLOT);
+  _liveInputs.assign(TernaryLayer::mask_count(_inputCount), 0);
+  _masks.clear();
+  _offsets.clear();
+  _weights.clear();
+  _biases.assign(_blockCount * BLOCK_SIZE, 0.0F);
+
+  const size_t needed = inputs.empty() ? 0 : *std::ranges::max_element(inputs) + size_t{1};
+  for (size_t row = 0; row < _neuronCount; ++row) {
+    const Neuron& neuron = layer[neurons[row]];
+    if (neuron.get_input_count() < needed) {
+      throw std::invalid_argument("Neuron " + std::to_string(neurons[row]) + " has " +
+                                  std::to_string(neuron.get_input_count()) +
+                                  " inputs, expected at least " + std::to_string(needed));
+    }
+    _biases[row] = neuron.get_bias();
+  }
+
+  // Sized up front so the packed storage is allocated once, at its exact size
+  size_t kept = 0;
+  size_t liveColumns = 0;
+  for (const uint32_t input : inputs) {
+    size_t column = 0;
+    for (const uint32_t neuron : neurons) {
+      column += Neuron::prune(layer[neuron].get_input_weight(input), threshold) != 0.0F ? 1 : 0;
+    }
+    kept += column;
+    liveColumns += column > 0 ? 1 : 0;
+  }
+  _weights.reserve(kept);
+  _masks.reserve(liveColumns * _blockCount + _blockCount);
+  _offsets.reserve(liveColumns * _blockCount + _blockCount);
+
+  for (size_t input = 0; input < _inputCount; ++input) {
+    const size_t slot = _masks.size() / std::max<size_t>(_blockCount, 1);
+    const size_t firstBlock = _masks.size();
+    for (size_t block = 0; block < _blockCount; ++block) {
+      BlockMask mask = 0;
+      _offsets.push_back(static_cast<uint32_t>(_weights.size()));
+      const size_t rows = std::min(BLOCK_SIZE, _neuronCount - block * BLOCK_SIZE);
+      for (size_t lane = 0; lane < rows; ++lane) {
+        const Neuron& neuron = layer[neurons[block * BLOCK_SIZE + lane]];
+        const Neuron::Value weight = neuron.get_input_weight(inputs[input]);
+        if (Neuron::prune(weight, threshold) != 0.0F) {
+          mask |= BlockMask{1} << lane;
+          _weights.push_back(weight);
+        }
+      }
+      _masks.push_back(mask);
+    }
+
+    // A column with nothing kept is taken back out and its input left without a slot
+    const auto blocks = std::span(_masks).subspan(firstBlock);
+    if (std::ranges::all_of(blocks, [](BlockMask mask) { return mask == 0; })) {
+      _masks.resize(firstBlock);
+      _offsets.resize(firstBlock);
+      continue;
+    }
+    _slots[input] = static_cast<Slot>(slot);
+    _liveInputs[input / TernaryLayer::MASK_BITS] |= Mask{1} << (input % TernaryLayer::MASK_BITS);
+  }
+}
+
+auto BlockSparseLayer::pre_activate(std::span<const Mask> positive,
+                                    std::span<const Mask> negative,
+                                    std::span<Neuron::Value> out) const -> void {
+  if (positive.size() != _liveInputs.size() || negative.size() != _liveInputs.size() ||
+      out.size() != _neuronCount) {
+    throw std::invalid_argument("Block sparse layer buffers do not match the layer dimensions");
+  }
+
+  // Blocks on the outside keep one block of sums in registers across every set bit
+  for (size_t block = 0; block < _blockCount; ++block) {
+    alignas(64) std::array<Neuron::Value, BLOCK_SIZE> lanes;
+    std::copy_n(_biases.begin() + block * BLOCK_SIZE, BLOCK_SIZE, lanes.begin());
+    add_columns(positive, block, 1.0F, lanes.data());
+    add_columns(negative, block, -1.0F, lanes.data());
+    const size_t rows = std::min(BLOCK_SIZE, _neuronCount - block * BLOCK_SIZE);
+    std::copy_n(lanes.begin(), rows, out.begin() + block * BLOCK_SIZE);
+  }
+}
+
+auto BlockSparseLayer::pre_activate(std::span<const Neuron::Value> inputs,
+                                    std::span<Neuron::Value> out) const -> void {
+  if (inputs.size() != _inputCount || out.size() != _neuronCount) {
+    throw std::invalid_argument("Block sparse layer buffers do not match the layer dimensions");
+  }
+
+  for (size_t block = 0; block < _blockCount; ++block) {
+    alignas(64) std::array<Neuron::Value, BLOCK_SIZE> lanes;
+    std::copy_n(_biases.begin() + block * BLOCK_SIZE, BLOCK_SIZE, lanes.begin());
+    for (size_t input = 0; input < _inputCount; ++input) {
+      if (inputs[input] != 0.0F && _slots[input] != NO_SLOT) {
+        add_block(_slots[input], block, inputs[input], lanes.data());
+      }
+    }
+    const size_t rows = std::min(BLOCK_SIZE, _neuronCount - block * BLOCK_SIZE);
+    std::copy_n(lanes.begin(), rows, out.begin() + block * BLOCK_SIZE);
+  }
+}
+
+auto BlockSparseLayer::add_column(size_t input,
+                                  Neuron::Value scale,
+                                  std::span<Neuron::Value> out) const -> void {
+  if (input >= _inputCount || out.size() != _neuronCount) {
+    throw std::invalid_argument("Column " + std::to_string(input) +
+                                " does not match the layer dimensions");
+  }
+  if (_slots[input] == NO_SLOT) {
+    return;
+  }
+  for (size_t block = 0; block < _blockCount; ++block) {
+    const size_t rows = std::min(BLOCK_SIZE, _neuronCount - block * BLOCK_SIZE);
+    alignas(64) std::array<Neuron::Value, BLOCK_SIZE> lanes{};
+    std::copy_n(out.begin() + block * BLOCK_SIZE, rows, lanes.begin());
+    add_block(_slots[input], block, scale, lanes.data());
+    std::copy_n(lanes.begin(), rows, out.begin() + block * BLOCK_SIZE);
+  }
+}
+
+auto BlockSparseLayer::get_input_count() const -> size_t {
+  return _inputCount;
+}
+
+auto BlockSparseLayer::get_neuron_count() const -> size_t {
+  return _neuronCount;
+}
+
+auto BlockSparseLayer::get_weight_count() const -> size_t {
+  return _weights.size();
+}
+
+auto BlockSparseLayer::memory_usage() const -> Util::MemoryUsage {
+  return Util::MemoryUsage{}
+      .add(_slots)
+      .add(_liveInputs)
+      .add(_masks)
+      .add(_offsets)
+      .add(_weights)
+      .add(_biases);
+}
+
+auto BlockSparseLayer::add_block(Slot slot,
+                                 size_t block,
+                                 Neuron::Value scale,
+                                 Neuron::Value* lanes) const -> void {
+  const size_t index = slot * _blockCount + block;
+  if (_masks[index] != 0) {
+    expand_axpy(_masks[index], _weights.data() + _offsets[index], scale, lanes);
+  }
+}
+
+auto BlockSparseLayer::add_columns(std::span<const Mask> masks,
+                                   size_t block,
+                                   Neuron::Value scale,
+                                   Neuron::Value* lanes) const -> void {
+  for (size_t word = 0; word < masks.size(); ++word) {
+    Mask bits = masks[word] & _liveInputs[word];
+    while (bits != 0) {
+      const size_t input = word * TernaryLayer::MASK_BITS + std::countr_zero(bits);
+      bits &= bits - 1;
+      add_block(_slots[input], block, scale, lanes);
+    }
+  }
+}
+
+auto PrunedNetwork::load(size_t inputs,
+                         const std::vector<std::vector<Neuron>>& hidden,
+                         const std::vector<Neuron>& output,
+                         Neuron::Value threshold) -> void {
+  // live[0] lists the network inputs and live[layer + 1] the live neurons of each layer; kept
+  // across loads so a newborn's brain reuses the lists
+  static thread_local std::vector<std::vector<uint32_t>> live;
+  const size_t layerCount = hidden.size() + 1;
+  auto layer_at = [&](size_t layer) -> const std::vector<Neuron>& {
+    return layer < hidden.size() ? hidden[layer] : output;
+  };
+  live.resize(layerCount + 1);
+  live[0].resize(inputs);
+  std::iota(live[0].begin(), live[0].end(), 0U);
+  live[layerCount].resize(output.size());
+  std::iota(live[layerCount].begin(), live[layerCount].end(), 0U);
+
+  // From the outputs back: a hidden neuron is live while a kept weight links it to a live
+  // neuron of the next layer
+  for (size_t layer = hidden.size(); layer-- > 0;) {
+    const std::vector<Neuron>& next = layer_at(layer + 1);
+    live[layer + 1].clear();
+    for (size_t neuron = 0; neuron < hidden[layer].size(); ++neuron) {
+      const bool reachesOutputs =
+          std::ranges::any_of(live[layer + 2], [&](uint32_t successor) {
+            return Neuron::prune(next[successor].get_input_weight(neuron), threshold) != 0.0F;
+          });
+      if (reachesOutputs) {
+        live[layer + 1].push_back(static_cast<uint32_t>(neuron));
+      }
+    }
+  }
+
+  _first.build(layer_at(0), live[1], live[0], threshold);
+  _layers.resize(layerCount - 1);
+  for (size_t layer = 1; layer < layerCount; ++layer) {
+    _layers[layer - 1].build(layer_at(layer), live[layer + 1], live[layer], threshold);
+  }
+}
+
+auto PrunedNetwork::get_first_layer() const -> const BlockSparseLayer& {
+  return _first;
+}
+
+auto PrunedNetwork::propagate(std::span<const Neuron::Value> firstLayer,
+                              std::span<Neuron::Value> outputs) -> void {
+  if (_layers.empty() || firstLayer.size() != _layers.front().get_input_count() ||
+      outputs.size() != _layers.back().get_neuron_count()) {
+    throw std::invalid_argument("Pruned network buffers do not match the network dimensions");
+  }
+
+  std::span<const Neuron::Value> values = firstLayer;
+  for (size_t index = 0; index < _layers.size(); ++index) {
+    const BlockSparseLayer& layer = _layers[index];
+    std::span<Neuron::Value> out = outputs;
+    if (index + 1 < _layers.size()) {
+      std::vector<Neuron::Value>& scratch = _values[index % _values.size()];
+      scratch.resize(layer.get_neuron_count());
+      out = scratch;
+    }
+    layer.pre_activate(values, out);
+    for (Neuron::Value& value : out) {
+      value = Neuron::activation_function(value);
+    }
+    values = out;
+  }
+}
+
+auto PrunedNetwork::get_weight_count() const -> size_t {
+  size_t count = _first.get_weight_count();
+  for (const BlockSparseLayer& layer : _layers) {
+    count += layer.get_weight_count();
+  }
+  return count;
+}
+
+auto PrunedNetwork::memory_usage() const -> Util::MemoryUsage {
+  return _first.memory_usage() +
+         Util::MemoryUsage{}.add_each(_layers).add(_values[0]).add(_values[1]);
+}
+
+}  // namespace Inference
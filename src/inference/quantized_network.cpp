@@ -0,0 +1,298 @@
+#include "inference/quantized_network.hpp"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+namespace Inference {
+
+namespace {
+// Sum of a[i] * w[i] for unsigned activations and signed weights; count is a multiple of 32
+auto dot(const uint8_t* a, const int8_t* w, size_t count) -> int32_t {
+#if defined(__AVX512VNNI__) && defined(__AVX512VL__)
+  __m256i sum = _mm256_setzero_si256();
+  for (size_t i = 0; i < count; i += 32) {
+    const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+    const __m256i vw = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(w + i));
+    sum = _mm256_dpbusd_epi32(sum, va, vw);
+  }
+#elif defined(__AVX2__)
+  const __m256i ones = _mm256_set1_epi16(1);
+  __m256i sum = _mm256_setzero_si256();
+  for (size_t i = 0; i < count; i += 32) {
+    const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+    const __m256i vw = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(w + i));
+    // pmaddubsw: u8 x s8 -> pairwise s16 sums (cannot saturate for a <= 127), then widen
+    const __m256i pairs = _mm256_maddubs_epi16(va, vw);
+    sum = _mm256_add_epi32(sum, _mm256_madd_epi16(pairs, ones));
+  }
+#endif
+#if defined(__AVX2__)
+  __m128i half = _mm_add_epi32(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1));
+  half = _mm_add_epi32(half, _mm_shuffle_epi32(half, _MM_SHUFFLE(1, 0, 3, 2)));
+  half = _mm_add_epi32(half, _mm_shuffle_epi32(half, _MM_SHUFFLE(2, 3, 0, 1)));
+  return _mm_cvtsi128_si32(half);
+#else
+  int32_t sum = 0;
+  for (size_t i = 0; i < count; ++i) {
+    sum += static_cast<int32_t>(a[i]) * static_cast<int32_t>(w[i]);
+  }
+  return sum;
+#endif
+}
+
+// Per-neuron weight step that maps the neuron's largest weight magnitude to 127
+auto weight_step(const Neuron& neuron, size_t inputCount) -> float {
+  float largest = 0.0F;
+  for (size_t input = 0; input < inputCount; ++input) {
+    largest = std::max(largest, std::abs(neuron.get_input_weight(input)));
+  }
+  return largest > 0.0F ? largest / 127.0F : 1.0F;
+}
+
+auto quantize_weight(float weight, float step) -> int8_t {
+  return static_cast<int8_t>(std::clamp(std::round(weight / step), -127.0F, 127.0F));
+}
+
+auto check_input_count(const Neuron& neuron, size_t index, size_t inputCount) -> void {
+  if (neuron.get_input_count() != inputCount) {
+    throw std::invalid_argument("Neuron " + std::to_string(index) + " has " +
+                                std::to_string(neuron.get_input_count()) + " inputs, expected " +
+                                std::to_string(inputCount));
+  }
+}
+
+// Adds the int8 column of every set bit to out, negated when Subtract; sums stay integers
+template <bool Subtract>
+auto accumulate_columns(std::span<const TernaryLayer::Mask> masks,
+                        const int8_t* columns,
+                        size_t neuronCount,
+                        Neuron::Value* out) -> void {
+  for (size_t word = 0; word < masks.size(); ++word) {
+    TernaryLayer::Mask bits = masks[word];
+    while (bits != 0) {
+      const size_t input = word * TernaryLayer::MASK_BITS + std::countr_zero(bits);
+      bits &= bits - 1;
+      const int8_t* column = columns + input * neuronCount;
+      for (size_t neuron = 0; neuron < neuronCount; ++neuron) {
+        if constexpr (Subtract) {
+          out[neuron] -= static_cast<Neuron::Value>(column[neuron]);
+        } else {
+          out[neuron] += static_cast<Neuron::Value>(column[neuron]);
+        }
+      }
+    }
+  }
+}
+}  // namespace
+
+auto QuantizedLayer::padded_size(size_t count) -> size_t {
+  return (count + ROW_ALIGNMENT - 1) / ROW_ALIGNMENT * ROW_ALIGNMENT;
+}
+
+auto QuantizedLayer::load(std::span<const Neuron> neurons, size_t inputCount) -> void {
+  _inputCount = inputCount;
+  _rowSize = padded_size(inputCount);
+  _neuronCount = neurons.size();
+  _weights.assign(_rowSize * _neuronCount, 0);
+  _scales.resize(_neuronCount);
+  _rowSums.resize(_neuronCount);
+  _biases.resize(_neuronCount);
+
+  for (size_t neuron = 0; neuron < _neuronCount; ++neuron) {
+    check_input_count(neurons[neuron], neuron, inputCount);
+    const float step = weight_step(neurons[neuron], inputCount);
+
+    int32_t rowSum = 0;
+    int8_t* row = _weights.data() + neuron * _rowSize;
+    for (size_t input = 0; input < inputCount; ++input) {
+      row[input] = quantize_weight(neurons[neuron].get_input_weight(input), step);
+      rowSum += row[input];
+    }
+    _scales[neuron] = step / ACTIVATION_SCALE;
+    _rowSums[neuron] = rowSum;
+    _biases[neuron] = neurons[neuron].get_bias();
+  }
+}
+
+auto QuantizedLayer::quantize(std::span<const Neuron::Value> values, std::span<uint8_t> out)
+    -> void {
+  for (size_t index = 0; index < values.size(); ++index) {
+    const float scaled = std::round(std::clamp(values[index], -1.0F, 1.0F) * ACTIVATION_SCALE);
+    out[index] = static_cast<uint8_t>(static_cast<int32_t>(scaled) + ACTIVATION_ZERO);
+  }
+  // Padding multiplies zero weights, any value works
+  std::fill(out.begin() + static_cast<std::ptrdiff_t>(values.size()), out.end(), ACTIVATION_ZERO);
+}
+
+auto QuantizedLayer::pre_activate(std::span<const uint8_t> inputs,
+                                  std::span<Neuron::Value> out) const -> void {
+  if (inputs.size() != _rowSize || out.size() != _neuronCount) {
+    throw std::invalid_argument("Quantized layer buffers do not match the layer dimensions");
+  }
+  for (size_t neuron = 0; neuron < _neuronCount; ++neuron) {
+    const int32_t raw = dot(inputs.data(), _weights.data() + neuron * _rowSize, _rowSize);
+    const int32_t centered = raw - ACTIVATION_ZERO * _rowSums[neuron];
+    out[neuron] = _biases[neuron] + _scales[neuron] * static_cast<float>(centered);
+  }
+}
+
+auto QuantizedLayer::get_input_count() const -> size_t {
+  return _inputCount;
+}
+
+auto QuantizedLayer::get_neuron_count() const -> size_t {
+  return _neuronCount;
+}
+
+auto QuantizedLayer::get_weight_bytes() const -> size_t {
+  return _weights.size() * sizeof(int8_t) +
+         (_scales.size() + _biases.size()) * sizeof(float) + _rowSums.size() * sizeof(int32_t);
+}
+
+auto QuantizedLayer::memory_usage() const -> Util::MemoryUsage {
+  return Util::MemoryUsage{}.add(_weights).add(_scales).add(_rowSums).add(_biases);
+}
+
+auto QuantizedTernaryLayer::build(std::span<const Neuron> neurons, size_t inputCount) -> void {
+  _inputCount = inputCount;
+  _neuronCount = neurons.size();
+  _columns.resize(_inputCount * _neuronCount);
+  _steps.resize(_neuronCount);
+  _biases.resize(_neuronCount);
+
+  for (size_t neuron = 0; neuron < _neuronCount; ++neuron) {
+    check_input_count(neurons[neuron], neuron, inputCount);
+    _steps[neuron] = weight_step(neurons[neuron], inputCount);
+    _biases[neuron] = neurons[neuron].get_bias();
+    for (size_t input = 0; input < _inputCount; ++input) {
+      _columns[input * _neuronCount + neuron] =
+          quantize_weight(neurons[neuron].get_input_weight(input), _steps[neuron]);
+    }
+  }
+}
+
+auto QuantizedTernaryLayer::pre_activate(std::span<const Mask> positive,
+                                         std::span<const Mask> negative,
+                                         std::span<Neuron::Value> out) const -> void {
+  const size_t masks = TernaryLayer::mask_count(_inputCount);
+  if (positive.size() != masks || negative.size() != masks || out.size() != _neuronCount) {
+    throw std::invalid_argument("Ternary layer buffers do not match the layer dimensions");
+  }
+
+  std::ranges::fill(out, 0.0F);
+  accumulate_columns<false>(positive, _columns.data(), _neuronCount, out.data());
+  accumulate_columns<true>(negative, _columns.data(), _neuronCount, out.data());
+  for (size_t neuron = 0; neuron < _neuronCount; ++neuron) {
+    out[neuron] = _biases[neuron] + _steps[neuron] * out[neuron];
+  }
+}
+
+auto QuantizedTernaryLayer::pre_activate(std::span<const Neuron::Value> inputs,
+                                         std::span<Neuron::Value> out) const -> void {
+  if (inputs.size() != _inputCount || out.size() != _neuronCount) {
+    throw std::invalid_argument("Ternary layer buffers do not match the layer dimensions");
+  }
+
+  std::ranges::copy(_biases, out.begin());
+  for (size_t input = 0; input < _inputCount; ++input) {
+    if (inputs[input] != 0.0F) {
+      add_column(input, inputs[input], out);
+    }
+  }
+}
+
+auto QuantizedTernaryLayer::add_column(size_t input,
+                                       Neuron::Value scale,
+                                       std::span<Neuron::Value> out) const -> void {
+  if (input >= _inputCount || out.size() != _neuronCount) {
+    throw std::invalid_argument("Column " + std::to_string(input) +
+                                " does not match the layer dimensions");
+  }
+  const int8_t* column = _columns.data() + input * _neuronCount;
+  for (size_t neuron = 0; neuron < _neuronCount; ++neuron) {
+    out[neuron] += scale * _steps[neuron] * static_cast<Neuron::Value>(column[neuron]);
+  }
+}
+
+auto QuantizedTernaryLayer::get_input_count() const -> size_t {
+  return _inputCount;
+}
+
+auto QuantizedTernaryLayer::get_neuron_count() const -> size_t {
+  return _neuronCount;
+}
+
+auto QuantizedTernaryLayer::get_weight_bytes() const -> size_t {
+  return _columns.size() * sizeof(int8_t) + (_steps.size() + _biases.size()) * sizeof(float);
+}
+
+auto QuantizedTernaryLayer::memory_usage() const -> Util::MemoryUsage {
+  return Util::MemoryUsage{}.add(_columns).add(_steps).add(_biases);
+}
+
+auto QuantizedNetwork::load(size_t inputs,
+                            const std::vector<std::vector<Neuron>>& hidden,
+                            const std::vector<Neuron>& output) -> void {
+  _first.build(hidden.empty() ? output : hidden.front(), inputs);
+  _layers.clear();
+  if (hidden.empty()) {
+    return;
+  }
+  _layers.reserve(hidden.size());
+  for (size_t layer = 1; layer < hidden.size(); ++layer) {
+    _layers.emplace_back().load(hidden[layer], hidden[layer - 1].size());
+  }
+  _layers.emplace_back().load(output, hidden.back().size());
+}
+
+auto QuantizedNetwork::get_first_layer() const -> const QuantizedTernaryLayer& {
+  return _first;
+}
+
+auto QuantizedNetwork::propagate(std::span<const Neuron::Value> firstLayer,
+                                 std::span<Neuron::Value> outputs) -> void {
+  if (_layers.empty() || firstLayer.size() != _layers.front().get_input_count() ||
+      outputs.size() != _layers.back().get_neuron_count()) {
+    throw std::invalid_argument("Quantized network buffers do not match the network dimensions");
+  }
+
+  std::span<const Neuron::Value> values = firstLayer;
+  for (size_t index = 0; index < _layers.size(); ++index) {
+    const QuantizedLayer& layer = _layers[index];
+    _quantized.resize(QuantizedLayer::padded_size(layer.get_input_count()));
+    QuantizedLayer::quantize(values, _quantized);
+
+    // values is consumed once quantized, so _values can be reused for this layer's output
+    std::span<Neuron::Value> out = outputs;
+    if (index + 1 < _layers.size()) {
+      _values.resize(layer.get_neuron_count());
+      out = _values;
+    }
+    layer.pre_activate(_quantized, out);
+    for (Neuron::Value& value : out) {
+      value = Neuron::activation_function(value);
+    }
+    values = out;
+  }
+}
+
+auto QuantizedNetwork::get_weight_bytes() const -> size_t {
+  size_t bytes = _first.get_weight_bytes();
+  for (const QuantizedLayer& layer : _layers) {
+    bytes += layer.get_weight_bytes();
+  }
+  return bytes;
+}
+
+auto QuantizedNetwork::memory_usage() const -> Util::MemoryUsage {
+  return _first.memory_usage() + Util::MemoryUsage{}.add_each(_layers).add(_quantized).add(_values);
+}
+
+}  // namespace Inference
@@ -0,0 +1,27 @@
+#include "inference/static_network.hpp"
+
+namespace Inference {
+
+namespace {
+template <typename Kernel>
+auto try_make(const std::vector<std::vector<Neuron>>& hidden, const std::vector<Neuron>& output)
+    -> std::unique_ptr<StaticKernel> {
+  if (!Kernel::matches(hidden, output)) {
+    return nullptr;
+  }
+  auto kernel = std::make_unique<Kernel>();
+  kernel->load(hidden, output);
+  return kernel;
+}
+}  // namespace
+
+auto make_static_network(const std::vector<std::vector<Neuron>>& hidden,
+                         const std::vector<Neuron>& output) -> std::unique_ptr<StaticKernel> {
+  if (auto kernel = try_make<ProductionTail>(hidden, output)) {
+    return kernel;
+  }
+  // Single hidden layer variant of the production brain
+  return try_make<StaticTail<16, 1, 2, TanhActivation>>(hidden, output);
+}
+
+}  // namespace Inference
@@ -0,0 +1,118 @@
+#include "inference/ternary_layer.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+#include <string>
+
+namespace Inference {
+
+namespace {
+template <bool Subtract>
+auto accumulate_columns(std::span<const TernaryLayer::Mask> masks,
+                        const Neuron::Value* columns,
+                        size_t neuronCount,
+                        Neuron::Value* out) -> void {
+  for (size_t word = 0; word < masks.size(); ++word) {
+    TernaryLayer::Mask bits = masks[word];
+    while (bits != 0) {
+      const size_t input = word * TernaryLayer::MASK_BITS + std::countr_zero(bits);
+      bits &= bits - 1;
+      const Neuron::Value* column = columns + input * neuronCount;
+      for (size_t neuron = 0; neuron < neuronCount; ++neuron) {
+        if constexpr (Subtract) {
+          out[neuron] -= column[neuron];
+        } else {
+          out[neuron] += column[neuron];
+        }
+      }
+    }
+  }
+}
+}  // namespace
+
+auto TernaryLayer::build(std::span<const Neuron> neurons, size_t inputCount) -> void {
+  _inputCount = inputCount;
+  _neuronCount = neurons.size();
+  _columns.resize(_inputCount * _neuronCount);
+  _biases.resize(_neuronCount);
+
+  for (size_t neuron = 0; neuron < _neuronCount; ++neuron) {
+    if (neurons[neuron].get_input_count() != _inputCount) {
+      throw std::invalid_argument("Neuron " + std::to_string(neuron) + " has " +
+                                  std::to_string(neurons[neuron].get_input_count()) +
+                                  " inputs, expected " + std::to_string(_inputCount));
+    }
+    _biases[neuron] = neurons[neuron].get_bias();
+    for (size_t input = 0; input < _inputCount; ++input) {
+      _columns[input * _neuronCount + neuron] = neurons[neuron].get_input_weight(input);
+    }
+  }
+}
+
+auto TernaryLayer::pre_activate(std::span<const Mask> positive,
+                                std::span<const Mask> negative,
+                                std::span<Neuron::Value> out) const -> void {
+  const size_t masks = mask_count(_inputCount);
+  if (positive.size() != masks || negative.size() != masks || out.size() != _neuronCount) {
+    throw std::invalid_argument("Ternary layer buffers do not match the layer dimensions");
+  }
+
+  std::ranges::copy(_biases, out.begin());
+  accumulate_columns<false>(positive, _columns.data(), _neuronCount, out.data());
+  accumulate_columns<true>(negative, _columns.data(), _neuronCount, out.data());
+}
+
+auto TernaryLayer::add_column(size_t input,
+                              Neuron::Value scale,
+                              std::span<Neuron::Value> out) const -> void {
+  if (input >= _inputCount || out.size() != _neuronCount) {
+    throw std::invalid_argument("Column " + std::to_string(input) +
+                                " does not match the layer dimensions");
+  }
+  const Neuron::Value* column = _columns.data() + input * _neuronCount;
+  for (size_t neuron = 0; neuron < _neuronCount; ++neuron) {
+    out[neuron] += scale * column[neuron];
+  }
+}
+
+auto TernaryLayer::pack(std::span<const Neuron::Value> values,
+                        std::span<Mask> positive,
+                        std::span<Mask> negative) -> bool {
+  const size_t masks = mask_count(values.size());
+  if (positive.size() != masks || negative.size() != masks) {
+    throw std::invalid_argument("Ternary masks do not match the number of values");
+  }
+
+  std::ranges::fill(positive, 0);
+  std::ranges::fill(negative, 0);
+  for (size_t index = 0; index < values.size(); ++index) {
+    const Mask bit = Mask{1} << (index % MASK_BITS);
+    if (values[index] == 1.0F) {
+      positive[index / MASK_BITS] |= bit;
+    } else if (values[index] == -1.0F) {
+      negative[index / MASK_BITS] |= bit;
+    } else if (values[index] != 0.0F) {
+      return false;
+    }
+  }
+  return true;
+}
+
+auto TernaryLayer::mask_count(size_t inputCount) -> size_t {
+  return (inputCount + MASK_BITS - 1) / MASK_BITS;
+}
+
+auto TernaryLayer::get_input_count() const -> size_t {
+  return _inputCount;
+}
+
+auto TernaryLayer::get_neuron_count() const -> size_t {
+  return _neuronCount;
+}
+
+auto TernaryLayer::memory_usage() const -> Util::MemoryUsage {
+  return Util::MemoryUsage{}.add(_columns).add(_biases);
+}
+
+}  // namespace Inference
@@ -0,0 +1,82 @@
+#include "label_batch.hpp"
+
+#include <fmt/format.h>
+#include <raylib.h>
+
+#include <algorithm>
+
+LabelBatch::LabelBatch(float fontSize, float spacing) : _fontSize(fontSize), _spacing(spacing) {}
+
+auto LabelBatch::format_coordinates(Vector2 position, Buffer& buffer) -> std::string_view {
+  const auto result =
+      fmt::format_to_n(buffer.data(), MAX_LABEL_LENGTH, "({:.2f}, {:.2f})", position.x, position.y);
+  const size_t length = std::min(result.size, MAX_LABEL_LENGTH);
+  buffer[length] = '\0';
+  return {buffer.data(), length};
+}
+
+auto LabelBatch::load_glyph_widths() -> void {
+  // Measuring one glyph at a time yields its scaled advance without any spacing, which is
+  // exactly what MeasureTextEx sums per character
+  char glyph[2] = {0, 0};
+  for (size_t index = 0; index < GLYPH_COUNT; ++index) {
+    glyph[0] = static_cast<char>(FIRST_GLYPH + index);
+    _glyphWidths[index] = MeasureTextEx(GetFontDefault(), glyph, _fontSize, _spacing).x;
+  }
+  _glyphsLoaded = true;
+}
+
+auto LabelBatch::measure(std::string_view text) -> Vector2 {
+  if (!_glyphsLoaded) {
+    load_glyph_widths();
+  }
+  if (text.empty()) {
+    return {0.0F, _fontSize};
+  }
+
+  float width = _spacing * static_cast<float>(text.size() - 1);
+  for (const char character : text) {
+    const size_t index = static_cast<unsigned char>(character) - FIRST_GLYPH;
+    if (index < GLYPH_COUNT) {
+      width += _glyphWidths[index];
+    }
+  }
+  return {width, _fontSize};
+}
+
+auto LabelBatch::add(Vector2 position, std::string_view text, Color color) -> void {
+  if (_count == _labels.size()) {
+    _labels.emplace_back();
+  }
+  Label& label = _labels[_count++];
+  const size_t length = std::min(text.size(), MAX_LABEL_LENGTH);
+  std::copy_n(text.begin(), length, label.text.begin());
+  label.text[length] = '\0';
+  label.position = position;
+  label.color = color;
+}
+
+auto LabelBatch::flush() -> void {
+  const Font font = GetFontDefault();
+  for (size_t index = 0; index < _count; ++index) {
+    const Label& label = _labels[index];
+    DrawTextEx(font, label.text.data(), label.position, _fontSize, _spacing, label.color);
+  }
+  _count = 0;
+}
+
+auto LabelBatch::size() const -> size_t {
+  return _count;
+}
+
+auto LabelBatch::memory_usage() const -> Util::MemoryUsage {
+  return Util::MemoryUsage{}.add(_labels);
+}
+
+auto LabelBatch::get_font_size() const -> float {
+  return _fontSize;
+}
+
+auto LabelBatch::get_spacing() const -> float {
+  return _spacing;
+}
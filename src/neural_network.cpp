@@ -1,6 +1,7 @@
 #include "neural_network.hpp"
 
 #include <algorithm>
+#include <bit>
 #include <random>
 #include <stdexcept>
 
@@ -19,9 +20,16 @@ NeuralNetwork::NeuralNetwork(const NeuralNetwork& other)
     : _hiddenLayers(other._hiddenLayers),
       _outputLayer(other._outputLayer),
       _inputsValues(other._inputsValues),
+      _outputValues(other._outputValues),
+      _precision(other._precision),
+      _pruneThreshold(other._pruneThreshold),
       _ready(other._ready),
       _hiddenLayerNeuronCount(other._hiddenLayerNeuronCount),
-      _validated(other._validated) {}
+      _validated(other._validated) {
+  if (other._floatWeightsReleased) {
+    adopt_released_weights(other._quantizedNetwork);
+  }
+}
 
 // Copy assignment
 auto NeuralNetwork::operator=(const NeuralNetwork& other) -> NeuralNetwork& {
@@ -29,9 +37,18 @@ auto NeuralNetwork::operator=(const NeuralNetwork& other) -> NeuralNetwork& {
     _hiddenLayers = other._hiddenLayers;
     _outputLayer = other._outputLayer;
     _inputsValues = other._inputsValues;
+    _outputValues = other._outputValues;
+    _precision = other._precision;
+    _pruneThreshold = other._pruneThreshold;
     _ready = other._ready;
     _validated = other._validated;
     _hiddenLayerNeuronCount = other._hiddenLayerNeuronCount;
+    _floatWeightsReleased = false;
+    weights_changed();
+    if (other._floatWeightsReleased) {
+      adopt_released_weights(other._quantizedNetwork);
+    }
+    _inputMasksCurrent = false;
   }
   return *this;
 }
@@ -41,9 +58,16 @@ NeuralNetwork::NeuralNetwork(NeuralNetwork&& other) noexcept
     : _hiddenLayers(std::move(other._hiddenLayers)),
       _outputLayer(std::move(other._outputLayer)),
       _inputsValues(std::move(other._inputsValues)),
+      _outputValues(std::move(other._outputValues)),
+      _precision(other._precision),
+      _pruneThreshold(other._pruneThreshold),
       _ready(other._ready),
       _validated(other._validated),
-      _hiddenLayerNeuronCount(other._hiddenLayerNeuronCount) {}
+      _hiddenLayerNeuronCount(other._hiddenLayerNeuronCount) {
+  if (other._floatWeightsReleased) {
+    adopt_released_weights(std::move(other._quantizedNetwork));
+  }
+}
 
 // Move assignment
 auto NeuralNetwork::operator=(NeuralNetwork&& other) noexcept -> NeuralNetwork& {
@@ -51,9 +75,18 @@ auto NeuralNetwork::operator=(NeuralNetwork&& other) noexcept -> NeuralNetwork&
     _hiddenLayers = std::move(other._hiddenLayers);
     _outputLayer = std::move(other._outputLayer);
     _inputsValues = std::move(other._inputsValues);
+    _outputValues = std::move(other._outputValues);
+    _precision = other._precision;
+    _pruneThreshold = other._pruneThreshold;
     _ready = other._ready;
     _hiddenLayerNeuronCount = other._hiddenLayerNeuronCount;
     _validated = other._validated;
+    _floatWeightsReleased = false;
+    weights_changed();
+    if (other._floatWeightsReleased) {
+      adopt_released_weights(std::move(other._quantizedNetwork));
+    }
+    _inputMasksCurrent = false;
   }
   return *this;
 }
@@ -62,21 +95,109 @@ auto NeuralNetwork::operator=(NeuralNetwork&& other) noexcept -> NeuralNetwork&
 auto NeuralNetwork::operator==(const NeuralNetwork& other) const -> bool {
   return _hiddenLayerNeuronCount == other._hiddenLayerNeuronCount &&
          _validated == other._validated && _ready == other._ready &&
+         _precision == other._precision && _pruneThreshold == other._pruneThreshold &&
          _inputsValues == other._inputsValues && _outputValues == other._outputValues &&
          _hiddenLayers == other._hiddenLayers && _outputLayer == other._outputLayer;
 }
 
 auto NeuralNetwork::set_input_values(const ValueVector& input) -> void {
-  _inputsValues = input;
+  set_input_values(std::span<const Neuron::Value>(input));
+}
+
+auto NeuralNetwork::set_input_values(std::span<const Neuron::Value> input) -> void {
+  // assign() reuses the existing storage when the size is unchanged
+  _inputsValues.assign(input.begin(), input.end());
+  _ready = false;
+  _inputMasksCurrent = false;
+  _firstLayerSumsValid = false;
+}
+
+auto NeuralNetwork::get_input_buffer() -> std::span<Neuron::Value> {
+  _ready = false;
+  _inputMasksCurrent = false;
+  _firstLayerSumsValid = false;
+  return _inputsValues;
+}
+
+auto NeuralNetwork::set_input_masks(std::span<const Inference::TernaryLayer::Mask> positive,
+                                    std::span<const Inference::TernaryLayer::Mask> negative)
+    -> void {
+  using Inference::TernaryLayer;
+  const size_t maskCount = TernaryLayer::mask_count(_inputsValues.size());
+  if (positive.size() != maskCount || negative.size() != maskCount) {
+    throw std::invalid_argument("Input masks do not match the network input count");
+  }
+
+  // Compared against the previous masks, only the inputs whose bits flipped need their
+  // weight columns applied to the first-layer sums
+  size_t changes = 0;
+  if (_inputMasksCurrent) {
+    for (size_t word = 0; word < maskCount; ++word) {
+      changes += std::popcount((positive[word] ^ _positiveInputs[word]) |
+                               (negative[word] ^ _negativeInputs[word]));
+    }
+    if (changes == 0) {
+      return;
+    }
+  }
+  const bool incremental = _inputMasksCurrent && can_update_incrementally(changes);
+
+  // Keep the float inputs in sync for get_input_values() and serialization
+  for (size_t index = 0; index < _inputsValues.size(); ++index) {
+    const auto word = index / TernaryLayer::MASK_BITS;
+    const auto bit = TernaryLayer::Mask{1} << (index % TernaryLayer::MASK_BITS);
+    Neuron::Value value = 0.0F;
+    if ((positive[word] & bit) != 0) {
+      value = 1.0F;
+    } else if ((negative[word] & bit) != 0) {
+      value = -1.0F;
+    }
+    if (incremental && value != _inputsValues[index]) {
+      add_first_layer_column(index, value - _inputsValues[index]);
+    }
+    _inputsValues[index] = value;
+  }
+  _positiveInputs.assign(positive.begin(), positive.end());
+  _negativeInputs.assign(negative.begin(), negative.end());
+
+  if (incremental) {
+    ++_incrementalUpdates;
+  } else {
+    _firstLayerSumsValid = false;
+  }
   _ready = false;
+  _inputMasksCurrent = true;
+}
+
+auto NeuralNetwork::apply_input_changes(std::span<const InputChange> changes) -> void {
+  const bool incremental = can_update_incrementally(changes.size());
+  for (const InputChange& change : changes) {
+    Neuron::Value& input = _inputsValues.at(change.index);
+    if (incremental && change.value != input) {
+      add_first_layer_column(change.index, change.value - input);
+    }
+    input = change.value;
+  }
+
+  if (incremental) {
+    ++_incrementalUpdates;
+  } else {
+    _firstLayerSumsValid = false;
+  }
+  _ready = false;
+  _inputMasksCurrent = false;
 }
 
 auto NeuralNetwork::set_input_count(size_t count) -> void {
+  require_float_weights();
   _inputsValues.resize(count, 0.0f);
+  _inputMasksCurrent = false;
   if (_hiddenLayers.size() > 0) {
     configure_hidden_layer(0);
   }
   _ready = false;
+  _validated = false;
+  weights_changed();
 }
 
 auto NeuralNetwork::get_input_count() const -> size_t {
@@ -102,9 +223,12 @@ auto NeuralNetwork::configure_output_layer() -> void {
 }
 
 auto NeuralNetwork::set_output_neuron_count(size_t count) -> void {
+  require_float_weights();
   _outputLayer.resize(count);
   configure_output_layer();
   _ready = false;
+  _validated = false;
+  weights_changed();
 }
 
 auto NeuralNetwork::get_output_neuron_count() const -> size_t {
@@ -137,9 +261,12 @@ auto NeuralNetwork::configure_hidden_layers() -> void {
 }
 
 auto NeuralNetwork::set_hidden_layer_count(size_t count) -> void {
+  require_float_weights();
   _hiddenLayers.resize(count);
   configure_hidden_layers();
   _ready = false;
+  _validated = false;
+  weights_changed();
 }
 
 auto NeuralNetwork::get_hidden_layer_count() const -> size_t {
@@ -147,10 +274,13 @@ auto NeuralNetwork::get_hidden_layer_count() const -> size_t {
 }
 
 auto NeuralNetwork::set_hidden_layer_neuron_count(size_t count) -> void {
+  require_float_weights();
   _hiddenLayerNeuronCount = count;
   configure_hidden_layers();
   configure_output_layer();
   _ready = false;
+  _validated = false;
+  weights_changed();
 }
 
 auto NeuralNetwork::get_hidden_layer_neuron_count() const -> size_t {
@@ -158,6 +288,7 @@ auto NeuralNetwork::get_hidden_layer_neuron_count() const -> size_t {
 }
 
 auto NeuralNetwork::randomize() -> void {
+  require_float_weights();
   // Randomize hidden layers
   for (auto& layer : _hiddenLayers) {
     for (auto& neuron : layer) {
@@ -171,6 +302,288 @@ auto NeuralNetwork::randomize() -> void {
   }
 
   _ready = false;
+  weights_changed();
+}
+
+auto NeuralNetwork::get_parameter_count() const -> size_t {
+  require_float_weights();
+  size_t count = 0;
+  for (const auto& layer : _hiddenLayers) {
+    for (const auto& neuron : layer) {
+      count += neuron.get_input_count() + 1;
+    }
+  }
+  for (const auto& neuron : _outputLayer) {
+    count += neuron.get_input_count() + 1;
+  }
+  return count;
+}
+
+auto NeuralNetwork::get_parameters(std::span<Neuron::Value> out) const -> void {
+  require_float_weights();
+  if (out.size() != get_parameter_count()) {
+    throw std::invalid_argument("Parameter buffer size mismatch - expected " +
+                                std::to_string(get_parameter_count()) + " but got " +
+                                std::to_string(out.size()));
+  }
+  auto cursor = out.begin();
+  auto read_layer = [&](const Layer& layer) {
+    for (const auto& neuron : layer) {
+      *cursor++ = neuron.get_bias();
+      cursor = std::copy(neuron.get_weights().begin(), neuron.get_weights().end(), cursor);
+    }
+  };
+  std::for_each(_hiddenLayers.begin(), _hiddenLayers.end(), read_layer);
+  read_layer(_outputLayer);
+}
+
+auto NeuralNetwork::set_parameters(std::span<const Neuron::Value> parameters) -> void {
+  require_float_weights();
+  if (parameters.size() != get_parameter_count()) {
+    throw std::invalid_argument("Parameter count mismatch - expected " +
+                                std::to_string(get_parameter_count()) + " but got " +
+                                std::to_string(parameters.size()));
+  }
+  size_t offset = 0;
+  auto write_layer = [&](Layer& layer) {
+    for (auto& neuron : layer) {
+      neuron.set_bias(parameters[offset]);
+      neuron.set_weights(parameters.subspan(offset + 1, neuron.get_input_count()));
+      offset += neuron.get_input_count() + 1;
+    }
+  };
+  std::for_each(_hiddenLayers.begin(), _hiddenLayers.end(), write_layer);
+  write_layer(_outputLayer);
+  _ready = false;
+  weights_changed();
+}
+
+auto NeuralNetwork::weights_changed() -> void {
+  _ternaryLayerStale = true;
+  _firstLayerSumsValid = false;
+  _staticNetworkStale = true;
+  _quantizedNetworkStale = true;
+  _prunedNetworkStale = true;
+  _outputCache.clear();
+  // Each mode builds its own inference copies, so the other modes' copies are released
+  if (_precision == INT8 || is_pruning()) {
+    _ternaryLayer = Inference::TernaryLayer();
+    _staticNetwork.reset();
+  }
+  if (_precision != INT8) {
+    _quantizedNetwork = Inference::QuantizedNetwork();
+  }
+  if (!is_pruning()) {
+    _prunedNetwork = Inference::PrunedNetwork();
+  }
+}
+
+auto NeuralNetwork::require_float_weights() const -> void {
+  if (_floatWeightsReleased) {
+    throw std::logic_error(
+        "Network float weights were released; rebuild the network from its genome first");
+  }
+}
+
+auto NeuralNetwork::adopt_released_weights(Inference::QuantizedNetwork quantized) -> void {
+  _quantizedNetwork = std::move(quantized);
+  _quantizedNetworkStale = false;
+  _floatWeightsReleased = true;
+}
+
+auto NeuralNetwork::first_layer() const -> const Layer& {
+  return _hiddenLayers.empty() ? _outputLayer : _hiddenLayers.front();
+}
+
+auto NeuralNetwork::first_layer_columns() -> const Inference::TernaryLayer& {
+  if (_ternaryLayerStale) {
+    _ternaryLayer.build(first_layer(), get_input_count());
+    _ternaryLayerStale = false;
+  }
+  return _ternaryLayer;
+}
+
+auto NeuralNetwork::static_network() -> const Inference::StaticKernel* {
+  if (_staticNetworkStale) {
+    // Reloading the kernel in place means an ant given new weights of the same shape, as a
+    // newborn is, does not allocate a new one
+    if (!_staticNetwork || !_staticNetwork->reload(_hiddenLayers, _outputLayer)) {
+      _staticNetwork = Inference::make_static_network(_hiddenLayers, _outputLayer);
+    }
+    _staticNetworkStale = false;
+  }
+  return _staticNetwork.get();
+}
+
+auto NeuralNetwork::quantized_network() -> Inference::QuantizedNetwork& {
+  if (_quantizedNetworkStale) {
+    _quantizedNetwork.load(get_input_count(), _hiddenLayers, _outputLayer);
+    _quantizedNetworkStale = false;
+  }
+  return _quantizedNetwork;
+}
+
+auto NeuralNetwork::pruned_network() -> Inference::PrunedNetwork& {
+  if (_prunedNetworkStale) {
+    _prunedNetwork.load(get_input_count(), _hiddenLayers, _outputLayer, _pruneThreshold);
+    _prunedNetworkStale = false;
+  }
+  return _prunedNetwork;
+}
+
+auto NeuralNetwork::is_pruning() const -> bool {
+  return _precision == FLOAT && _pruneThreshold > 0.0F;
+}
+
+auto NeuralNetwork::add_first_layer_column(size_t input, Neuron::Value scale) -> void {
+  if (_precision == INT8) {
+    quantized_network().get_first_layer().add_column(input, scale, _firstLayerSums);
+  } else if (is_pruning()) {
+    pruned_network().get_first_layer().add_column(input, scale, _firstLayerSums);
+  } else {
+    first_layer_columns().add_column(input, scale, _firstLayerSums);
+  }
+}
+
+auto NeuralNetwork::can_update_incrementally(size_t changes) const -> bool {
+  return _firstLayerSumsValid && changes <= INCREMENTAL_UPDATE_THRESHOLD &&
+         _incrementalUpdates < MAX_INCREMENTAL_UPDATES;
+}
+
+auto NeuralNetwork::compute_first_layer_sums() -> void {
+  const Layer& layer = first_layer();
+  // Pruned brains only sum their live first-layer neurons
+  _firstLayerSums.resize(is_pruning() ? pruned_network().get_first_layer().get_neuron_count()
+                                      : layer.size());
+
+  // Sensing inputs are only ever -1, 0 or +1, in which case the first layer is evaluated
+  // from bitmasks by adding weight columns instead of full dot products
+  if (!_inputMasksCurrent) {
+    const size_t maskCount = Inference::TernaryLayer::mask_count(_inputsValues.size());
+    _positiveInputs.resize(maskCount);
+    _negativeInputs.resize(maskCount);
+    _inputMasksCurrent =
+        Inference::TernaryLayer::pack(_inputsValues, _positiveInputs, _negativeInputs);
+  }
+
+  if (_precision == INT8) {
+    const Inference::QuantizedTernaryLayer& columns = quantized_network().get_first_layer();
+    if (_inputMasksCurrent) {
+      columns.pre_activate(_positiveInputs, _negativeInputs, _firstLayerSums);
+    } else {
+      columns.pre_activate(_inputsValues, _firstLayerSums);
+    }
+  } else if (is_pruning()) {
+    const Inference::BlockSparseLayer& columns = pruned_network().get_first_layer();
+    if (_inputMasksCurrent) {
+      columns.pre_activate(_positiveInputs, _negativeInputs, _firstLayerSums);
+    } else {
+      columns.pre_activate(_inputsValues, _firstLayerSums);
+    }
+  } else if (_inputMasksCurrent) {
+    first_layer_columns().pre_activate(_positiveInputs, _negativeInputs, _firstLayerSums);
+  } else {
+    for (size_t neuronIndex = 0; neuronIndex < layer.size(); ++neuronIndex) {
+      _firstLayerSums[neuronIndex] = layer[neuronIndex].weighted_sum(_inputsValues);
+    }
+  }
+  _firstLayerSumsValid = true;
+  _incrementalUpdates = 0;
+}
+
+auto NeuralNetwork::set_precision(Precision precision) -> void {
+  if (precision != _precision) {
+    require_float_weights();
+    _precision = precision;
+    weights_changed();
+    _ready = false;
+  }
+}
+
+auto NeuralNetwork::get_precision() const -> Precision {
+  return _precision;
+}
+
+auto NeuralNetwork::release_float_weights() -> void {
+  if (_precision != INT8) {
+    throw std::logic_error("Only INT8 networks can run without their float weights");
+  }
+  if (_floatWeightsReleased) {
+    return;
+  }
+  // Checked and quantized while the floats are still here; the neurons keep the shape only
+  if (!_validated) {
+    validate();
+  }
+  quantized_network();
+  auto release_layer = [](Layer& layer) {
+    for (Neuron& neuron : layer) {
+      neuron = Neuron();
+    }
+  };
+  std::for_each(_hiddenLayers.begin(), _hiddenLayers.end(), release_layer);
+  release_layer(_outputLayer);
+  _floatWeightsReleased = true;
+}
+
+auto NeuralNetwork::has_float_weights() const -> bool {
+  return !_floatWeightsReleased;
+}
+
+auto NeuralNetwork::set_prune_threshold(float threshold) -> void {
+  if (threshold < 0.0F) {
+    throw std::invalid_argument("Prune threshold must not be negative");
+  }
+  if (threshold != _pruneThreshold) {
+    _pruneThreshold = threshold;
+    // INT8 forward passes never prune, so their weights and outputs stay as they are
+    if (_precision != INT8) {
+      weights_changed();
+      _ready = false;
+    }
+  }
+}
+
+auto NeuralNetwork::get_prune_threshold() const -> float {
+  return _pruneThreshold;
+}
+
+auto NeuralNetwork::get_sparsity() const -> float {
+  if (_pruneThreshold <= 0.0F || _precision == INT8) {
+    return 0.0F;
+  }
+  size_t weights = 0;
+  size_t pruned = 0;
+  auto count_layer = [&](const Layer& layer) {
+    for (const Neuron& neuron : layer) {
+      for (const Neuron::Value weight : neuron.get_weights()) {
+        pruned += Neuron::prune(weight, _pruneThreshold) == 0.0F ? 1 : 0;
+      }
+      weights += neuron.get_input_count();
+    }
+  };
+  std::for_each(_hiddenLayers.begin(), _hiddenLayers.end(), count_layer);
+  count_layer(_outputLayer);
+  return weights == 0 ? 0.0F : static_cast<float>(pruned) / static_cast<float>(weights);
+}
+
+auto NeuralNetwork::memory_usage() const -> Util::MemoryUsage {
+  Util::MemoryUsage usage;
+  usage.add(_hiddenLayers);
+  for (const Layer& layer : _hiddenLayers) {
+    usage.add_each(layer);
+  }
+  usage.add_each(_outputLayer);
+  usage.add(_inputsValues).add(_outputValues).add(_layerValues[0]).add(_layerValues[1]);
+  usage.add(_positiveInputs).add(_negativeInputs).add(_firstLayerSums);
+  usage += _ternaryLayer.memory_usage();
+  usage += _outputCache.memory_usage();
+  if (_staticNetwork) {
+    usage += {_staticNetwork->get_size_bytes(), 1};
+  }
+  usage += _quantizedNetwork.memory_usage();
+  usage += _prunedNetwork.memory_usage();
+  return usage;
 }
 
 auto NeuralNetwork::compute() -> void {
@@ -178,29 +591,57 @@ auto NeuralNetwork::compute() -> void {
     validate();
   }
 
-  ValueVector inputs;
-  _outputValues.clear();
+  // The first layer starts from its cached pre-activations; every later layer reads the
+  // previous layer's values in place, and the scratch buffers only reallocate when the
+  // topology changes
+  if (!_firstLayerSumsValid) {
+    compute_first_layer_sums();
+  }
   _outputValues.resize(_outputLayer.size());
 
+  ValueVector& firstOutputs = _hiddenLayers.empty() ? _outputValues : _layerValues[0];
+  firstOutputs.resize(_firstLayerSums.size());
+  for (size_t neuronIndex = 0; neuronIndex < _firstLayerSums.size(); ++neuronIndex) {
+    firstOutputs[neuronIndex] = Neuron::activation_function(_firstLayerSums[neuronIndex]);
+  }
   if (_hiddenLayers.empty()) {
-    inputs = get_input_values();
-  } else {
-    inputs = get_input_values();
-    ValueVector outputs;
-    outputs.reserve(_hiddenLayerNeuronCount);
-    for (size_t layerIndex = 0; layerIndex < _hiddenLayers.size(); ++layerIndex) {
-      outputs.clear();
-      for (size_t neuronIndex = 0; neuronIndex < _hiddenLayerNeuronCount; ++neuronIndex) {
-        _hiddenLayers[layerIndex][neuronIndex].set_inputs(inputs);
-        outputs.push_back(_hiddenLayers[layerIndex][neuronIndex].get_output());
-      }
-      inputs = outputs;
+    _ready = true;
+    return;
+  }
+
+  // Quantized brains trade a little accuracy for int8 weights and integer dot products
+  if (_precision == INT8) {
+    quantized_network().propagate(firstOutputs, _outputValues);
+    _ready = true;
+    return;
+  }
+
+  // Pruned brains run only the weights and neurons that can still change the outputs
+  if (is_pruning()) {
+    pruned_network().propagate(firstOutputs, _outputValues);
+    _ready = true;
+    return;
+  }
+
+  // The production topology runs the remaining layers through fixed-size unrolled kernels
+  if (const Inference::StaticKernel* kernel = static_network()) {
+    kernel->propagate(firstOutputs, _outputValues);
+    _ready = true;
+    return;
+  }
+
+  std::span<const Neuron::Value> inputs = firstOutputs;
+  for (size_t layerIndex = 1; layerIndex < _hiddenLayers.size(); ++layerIndex) {
+    ValueVector& outputs = _layerValues[layerIndex % _layerValues.size()];
+    outputs.resize(_hiddenLayerNeuronCount);
+    for (size_t neuronIndex = 0; neuronIndex < _hiddenLayerNeuronCount; ++neuronIndex) {
+      outputs[neuronIndex] = _hiddenLayers[layerIndex][neuronIndex].activate(inputs);
     }
+    inputs = outputs;
   }
 
   for (size_t neuronIndex = 0; neuronIndex < _outputLayer.size(); ++neuronIndex) {
-    _outputLayer[neuronIndex].set_inputs(inputs);
-    _outputValues[neuronIndex] = _outputLayer[neuronIndex].get_output();
+    _outputValues[neuronIndex] = _outputLayer[neuronIndex].activate(inputs);
   }
   _ready = true;
 }
@@ -221,7 +662,8 @@ auto NeuralNetwork::validate() -> void {
     _validated = true;
     return;
   }
-  for (size_t layerIdx = 0; auto& layer : _hiddenLayers) {
+  for (size_t layerIdx = 0; layerIdx < _hiddenLayers.size(); ++layerIdx) {
+    const Layer& layer = _hiddenLayers[layerIdx];
     if (layer.size() != _hiddenLayerNeuronCount) {
       throw std::runtime_error(
           "Hidden layer " + std::to_string(layerIdx) + " neuron count mismatch - expected " +
@@ -234,7 +676,6 @@ auto NeuralNetwork::validate() -> void {
               "First Hidden layer neuron input count does not match network input count");
         }
       }
-      continue;
     } else {
       for (const Neuron& neuron : layer) {
         if (neuron.get_input_count() != _hiddenLayerNeuronCount) {
@@ -254,20 +695,45 @@ auto NeuralNetwork::validate() -> void {
   _validated = true;
 }
 
-auto NeuralNetwork::get_output_values() -> ValueVector {
+auto NeuralNetwork::get_output_values() -> std::span<const Neuron::Value> {
   if (!_ready) {
+    // Ternary inputs seen recently are answered from the cache without a forward pass
+    if (_inputMasksCurrent) {
+      const auto cached = _outputCache.find(_positiveInputs, _negativeInputs);
+      if (!cached.empty()) {
+        _outputValues.assign(cached.begin(), cached.end());
+        _ready = true;
+        return _outputValues;
+      }
+    }
     this->compute();
+    ++_forwardPasses;
+    if (_inputMasksCurrent) {
+      _outputCache.insert(_positiveInputs, _negativeInputs, _outputValues);
+    }
   }
   return _outputValues;
 }
 
+auto NeuralNetwork::get_forward_pass_count() const -> uint64_t {
+  return _forwardPasses;
+}
+
+auto NeuralNetwork::get_output_cache_stats() const -> const Inference::OutputCache::Stats& {
+  return _outputCache.get_stats();
+}
+
 auto NeuralNetwork::set_output_layer(const Layer& layer) -> void {
+  require_float_weights();
   _outputLayer = layer;
   configure_output_layer();
   _ready = false;
+  _validated = false;
+  weights_changed();
 }
 
 auto NeuralNetwork::set_hidden_layer(size_t idx, const Layer& layer) -> void {
+  require_float_weights();
   if (idx >= _hiddenLayers.size()) {
     throw std::runtime_error("Hidden layer index out of bounds");
   }
@@ -278,9 +744,12 @@ auto NeuralNetwork::set_hidden_layer(size_t idx, const Layer& layer) -> void {
   }
   _hiddenLayers[idx] = layer;
   _ready = false;
+  _validated = false;
+  weights_changed();
 }
 
 auto NeuralNetwork::to_json() const -> nlohmann::json {
+  require_float_weights();
   nlohmann::json json;
 
   json["input_count"] = _inputsValues.size();
@@ -289,6 +758,8 @@ auto NeuralNetwork::to_json() const -> nlohmann::json {
   json["output_neuron_count"] = _outputLayer.size();
   json["validated"] = _validated;
   json["ready"] = _ready;
+  json["precision"] = _precision;
+  json["prune_threshold"] = _pruneThreshold;
 
   json["input_values"] = _inputsValues;
   json["output_values"] = _outputValues;
@@ -316,6 +787,8 @@ NeuralNetwork::NeuralNetwork(const nlohmann::json& json) {
   _hiddenLayerNeuronCount = json.at("hidden_layer_neuron_count").get<size_t>();
   _validated = json.at("validated").get<bool>();
   _ready = json.at("ready").get<bool>();
+  _precision = json.value("precision", FLOAT);
+  _pruneThreshold = json.value("prune_threshold", 0.0F);
 
   _inputsValues = json.at("input_values").get<ValueVector>();
   _outputValues = json.at("output_values").get<ValueVector>();
@@ -26,6 +26,25 @@ auto Neuron::get_input_weight(size_t idx) const -> Value {
   return _weights.at(idx);
 }
 
+auto Neuron::get_weights() const -> std::span<const Value> {
+  return _weights;
+}
+
+auto Neuron::get_weights() -> std::span<Value> {
+  _outputDirty = true;
+  return _weights;
+}
+
+auto Neuron::set_weights(std::span<const Value> weights) -> void {
+  if (weights.size() != _weights.size()) {
+    throw std::invalid_argument("Neuron weight count mismatch - expected " +
+                                std::to_string(_weights.size()) + " but got " +
+                                std::to_string(weights.size()));
+  }
+  std::copy(weights.begin(), weights.end(), _weights.begin());
+  _outputDirty = true;
+}
+
 auto Neuron::set_bias(double bias) -> void {
   _bias = static_cast<Value>(bias);
   _outputDirty = true;
@@ -49,6 +68,24 @@ auto Neuron::get_output() -> Value {
   return _value;
 }
 
+auto Neuron::activate(std::span<const Value> inputs) const -> Value {
+  return activation_function(weighted_sum(inputs));
+}
+
+auto Neuron::weighted_sum(std::span<const Value> inputs) const -> Value {
+  if (inputs.size() != _weights.size()) {
+    throw std::runtime_error("Input size mismatch: expected " + std::to_string(_weights.size()) +
+                             " but got " + std::to_string(inputs.size()));
+  }
+  Value sum = std::transform_reduce(inputs.begin(),
+                                    inputs.end(),
+                                    _weights.begin(),
+                                    0.0f,
+                                    std::plus<Value>{},
+                                    std::multiplies<Value>{});
+  return _bias + sum;
+}
+
 auto Neuron::get_input_count() const -> size_t {
   return _inputs.size();
 }
@@ -58,6 +95,10 @@ auto Neuron::set_input_count(size_t count) -> void {
   _weights.resize(count, 0.0f);
 }
 
+auto Neuron::memory_usage() const -> Util::MemoryUsage {
+  return Util::MemoryUsage{}.add(_weights).add(_inputs);
+}
+
 auto Neuron::operator=(const Neuron& other) -> Neuron& {
   if (this != &other) {
     _inputs = other._inputs;
@@ -105,9 +146,7 @@ Neuron::Neuron(const nlohmann::json& json) {
 }
 
 auto Neuron::randomize(RandomGenerator& rng) -> void {
-  for (auto& weight : _weights) {
-    weight = static_cast<Value>(rng.uniform(-3.0, 3.0));
-  }
+  rng.fill_uniform(_weights, -3.0F, 3.0F);
 
   _bias = static_cast<Value>(rng.uniform(-1.0, 1.0));
   _value = static_cast<Value>(rng.uniform(-1.0, 1.0));
@@ -12,6 +12,10 @@ Pangenome::Pangenome(const nlohmann::json& json) {
     _genomes.push_back(std::move(genome));
   }
   _topCycleIndex = json.at("top_cycle_index").get<size_t>();
+  _weightFormat = json.value("weight_format", Util::FP32);
+  for (Genome& genome : _genomes) {
+    genome.compact(_weightFormat);
+  }
 
   maintain_sorted_order();
 
@@ -33,6 +37,7 @@ auto Pangenome::add(Genome&& genome) -> void {
                              " for vector of size " + std::to_string(_genomes.size()));
   }
 
+  genome.compact(_weightFormat);
   _genomes.insert(_genomes.begin() + insertionPoint, std::move(genome));
 
   // Remove least fit genomes if we exceed max size
@@ -65,6 +70,7 @@ auto Pangenome::sample_top_cycle() -> const Genome& {
   // Store a static copy to return safely (since increment_child_count may remove the genome)
   static thread_local Genome selectedGenomeCopy;
   selectedGenomeCopy = _genomes[index];
+  selectedGenomeCopy.expand();
 
   // Increment child count for this parent (may remove genome from vector)
   increment_child_count(index);
@@ -89,6 +95,7 @@ auto Pangenome::sample_random() -> const Genome& {
   // Store a static copy to return safely (since increment_child_count may remove the genome)
   static thread_local Genome selectedGenomeCopy;
   selectedGenomeCopy = _genomes[randomIndex];
+  selectedGenomeCopy.expand();
 
   // Increment child count for this parent (may remove genome from vector)
   increment_child_count(static_cast<size_t>(randomIndex));
@@ -104,6 +111,36 @@ auto Pangenome::empty() const -> bool {
   return _genomes.empty();
 }
 
+auto Pangenome::get_top_fitness() const -> double {
+  return _genomes.empty() ? 0.0 : _genomes.front().get_fitness();
+}
+
+auto Pangenome::set_weight_format(Util::WeightFormat format) -> void {
+  if (format == _weightFormat) {
+    return;
+  }
+  _weightFormat = format;
+  for (Genome& genome : _genomes) {
+    genome.compact(format);
+  }
+}
+
+auto Pangenome::get_weight_format() const -> Util::WeightFormat {
+  return _weightFormat;
+}
+
+auto Pangenome::get_weight_bytes() const -> size_t {
+  size_t bytes = 0;
+  for (const Genome& genome : _genomes) {
+    bytes += genome.get_weight_bytes();
+  }
+  return bytes;
+}
+
+auto Pangenome::memory_usage() const -> Util::MemoryUsage {
+  return Util::MemoryUsage{}.add_each(_genomes);
+}
+
 auto Pangenome::to_json() const -> nlohmann::json {
   nlohmann::json j;
 
@@ -117,6 +154,7 @@ auto Pangenome::to_json() const -> nlohmann::json {
 
   j["genomes"] = genomesArray;
   j["top_cycle_index"] = _topCycleIndex;
+  j["weight_format"] = _weightFormat;
 
   return j;
 }
@@ -132,7 +170,7 @@ auto Pangenome::operator==(const Pangenome& other) const -> bool {
     }
   }
 
-  return _topCycleIndex == other._topCycleIndex;
+  return _topCycleIndex == other._topCycleIndex && _weightFormat == other._weightFormat;
 }
 
 auto Pangenome::maintain_sorted_order() -> void {
@@ -4,10 +4,13 @@
 #include <raymath.h>
 #include <tbb/blocked_range.h>
 #include <tbb/parallel_for.h>
+#include <tbb/parallel_reduce.h>
+#include <tbb/task_group.h>
 
 #include <algorithm>
 #include <ant.hpp>
 #include <cmath>
+#include <functional>
 #include <genome.hpp>
 #include <vector>
 #include <world.hpp>
@@ -28,13 +31,19 @@ Population::Population(const nlohmann::json& j, World& world) : _world(world) {
 }
 
 Population::Population(const Population& other)
-    : _world(other._world), _ants(other._ants), _size(other._size), _pangenome(other._pangenome) {}
+    : _world(other._world),
+      _ants(other._ants),
+      _size(other._size),
+      _pangenome(other._pangenome),
+      _history(other._history) {}
 
 Population& Population::operator=(const Population& other) {
   if (this != &other) {
     _ants = other._ants;
     _size = other._size;
     _pangenome = other._pangenome;
+    _history = other._history;
+    _spatialIndexDirty = true;
   }
   return *this;
 }
@@ -43,13 +52,16 @@ Population::Population(Population&& other)
     : _world(other._world),
       _ants(std::move(other._ants)),
       _size(other._size),
-      _pangenome(std::move(other._pangenome)) {}
+      _pangenome(std::move(other._pangenome)),
+      _history(std::move(other._history)) {}
 
 Population& Population::operator=(Population&& other) {
   if (this != &other) {
     _ants = std::move(other._ants);
     _size = other._size;
     _pangenome = std::move(other._pangenome);
+    _history = std::move(other._history);
+    _spatialIndexDirty = true;
   }
   return *this;
 }
@@ -79,6 +91,7 @@ auto Population::reproduce() -> void {
 }
 
 auto Population::create_ant() -> Ant {
+  ++_births;
   if (_pangenome.size() < Pangenome::MAX_PANGENOME_SIZE) {
     // Not enough genomes for breeding - create random ant
     Genome genome;
@@ -93,8 +106,7 @@ auto Population::create_ant() -> Ant {
   // Use structured breeding algorithm
   const Genome& parentA = _pangenome.sample_top_cycle();  // Top 20% round-robin
   const Genome& parentB = _pangenome.sample_random();     // Any genome
-  Genome parentACopy = parentA;  // Copy for breeding (breed_with is not const)
-  Genome child = parentACopy.breed_with(parentB);
+  Genome child = parentA.breed_with(parentB, _breedingRng);
   child.set_fitness(0.0F);  // Reset fitness for new ant
 
   Ant ant(_world, child);
@@ -105,6 +117,47 @@ auto Population::create_ant() -> Ant {
 }
 
 auto Population::update(float time) -> void {
+  Util::TickProfile profile;
+  update(time, profile);
+}
+
+auto Population::update(float time, Util::TickProfile& profile) -> void {
+  profile.measure(Util::TickProfile::SENSE, [&] { sense(time); });
+
+  // Thinking and moving never read the dead ants or draw random numbers, so the dead can be
+  // retired and bred from the pangenome in the meantime without changing the outcome
+  tbb::task_group retiring;
+  if (!profile.is_exclusive()) {
+    retiring.run([&] { retire(); });
+  }
+  uint64_t forwardPasses = 0;
+  profile.measure(Util::TickProfile::THINK, [&] { forwardPasses = think(); });
+  profile.measure(Util::TickProfile::MOVE, [&] { move(time); });
+  profile.measure(Util::TickProfile::RETIRE_BREED, [&] {
+    if (profile.is_exclusive()) {
+      retire();
+    }
+    retiring.wait();
+    reproduce();
+  });
+  profile.count(Util::TickProfile::ANTS_UPDATED, _living.size());
+  profile.count(Util::TickProfile::FORWARD_PASSES, forwardPasses);
+  profile.count(Util::TickProfile::BIRTHS, _births);
+
+  update_spatial_index();
+  record_history();
+}
+
+auto Population::record_history() -> void {
+  _history[MEAN_FITNESS].push(static_cast<float>(_fitnessData.get_mean()));
+  _history[TOP_FITNESS].push(static_cast<float>(_pangenome.get_top_fitness()));
+  _history[PANGENOME_SIZE].push(static_cast<float>(_pangenome.size()));
+  _history[BIRTHS].push(static_cast<float>(_births));
+  _history[DEATHS].push(static_cast<float>(_retiring.size()));
+  _births = 0;
+}
+
+auto Population::sense(float time) -> void {
   tbb::parallel_for(tbb::blocked_range<size_t>(0, _ants.size()),
                     [&](const tbb::blocked_range<size_t>& range) {
                       for (size_t i = range.begin(); i != range.end(); ++i) {
@@ -113,35 +166,71 @@ auto Population::update(float time) -> void {
                         if (_world.out_of_bounds(ant.get_position())) {
                           ant.set_dead(true);
                         }
+                        ant.sense(time);
+                      }
+                    });
 
-                        if (!ant.is_dead()) {
-                          ant.update(time);
-                        }
+  _living.clear();
+  _retiring.clear();
+  for (size_t i = 0; i < _ants.size(); ++i) {
+    (_ants[i].is_dead() ? _retiring : _living).push_back(i);
+  }
+}
+
+auto Population::think() -> uint64_t {
+  // Each range counts its own forward passes, so threads never share a counter
+  return tbb::parallel_reduce(
+      tbb::blocked_range<size_t>(0, _living.size()), uint64_t{0},
+      [&](const tbb::blocked_range<size_t>& range, uint64_t passes) {
+        for (size_t i = range.begin(); i != range.end(); ++i) {
+          Ant& ant = _ants[_living[i]];
+          const NeuralNetwork& network = ant.get_brain().get_network();
+          const uint64_t before = network.get_forward_pass_count();
+          ant.think();
+          passes += network.get_forward_pass_count() - before;
+        }
+        return passes;
+      },
+      std::plus<>());
+}
+
+auto Population::move(float time) -> void {
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, _living.size()),
+                    [&](const tbb::blocked_range<size_t>& range) {
+                      for (size_t i = range.begin(); i != range.end(); ++i) {
+                        _ants[_living[i]].move(time);
                       }
                     });
+}
 
-  for (Ant& ant : _ants) {
-    if (ant.is_dead()) {
-      // Add current life span to cumulative total
-      ant.set_cumulative_life_span(ant.get_cumulative_life_span() + ant.get_life_span());
-
-      if (ant.get_remaining_lives() > 0) {
-        // Ant has remaining lives - respawn for new life
-        ant.set_remaining_lives(ant.get_remaining_lives() - 1);
-        ant.reset(_world.spawn_position({ant.get_bounds().width, ant.get_bounds().height}));
-      } else {
-        // No remaining lives - calculate mean fitness and create new ant
-        double mean_life_span = ant.get_cumulative_life_span() / Ant::ANT_LIVES;
-        auto genome = ant.get_genome();
-        genome.set_fitness(mean_life_span);
-        _fitnessData.add_data(genome.get_fitness());
-        _pangenome.add(std::move(genome));
-        ant = create_ant();
-      }
+auto Population::retire() -> void {
+  for (size_t index : _retiring) {
+    Ant& ant = _ants[index];
+    // Add current life span to cumulative total
+    ant.set_cumulative_life_span(ant.get_cumulative_life_span() + ant.get_life_span());
+
+    if (ant.get_remaining_lives() > 0) {
+      // Ant has remaining lives - respawn for new life
+      ant.set_remaining_lives(ant.get_remaining_lives() - 1);
+      ant.reset(_world.spawn_position({ant.get_bounds().width, ant.get_bounds().height}));
+    } else {
+      // No remaining lives - calculate mean fitness and create new ant
+      double mean_life_span = ant.get_cumulative_life_span() / Ant::ANT_LIVES;
+      Genome genome = ant.get_genome();  // the pangenome keeps its own copy
+      genome.set_fitness(mean_life_span);
+      _fitnessData.add_data(genome.get_fitness());
+      _history[GENOME_FITNESS].push(static_cast<float>(genome.get_fitness()));
+      _pangenome.set_weight_format(_world.get_weight_format());
+      _pangenome.add(std::move(genome));
+      ant = create_ant();
     }
   }
+}
 
-  reproduce();
+auto Population::update_spatial_index() -> void {
+  _spatialIndex.set_bounds(_world.get_bounds(), INDEX_CELL_SIZE);
+  _spatialIndex.build(_ants.size(), [&](size_t index) { return _ants[index].get_position(); });
+  _spatialIndexDirty = false;
 }
 
 auto Population::get_collisions(const Vector2& position, float radius)
@@ -155,6 +244,22 @@ auto Population::get_collisions(const Vector2& position, float radius)
   return touchingAnts;
 }
 
+auto Population::first_contact(const Vector2& position, float radius) const -> size_t {
+  // Every touching ant is considered so the result does not depend on bucket order
+  size_t first = NO_ANT;
+  for_each_contact(position, radius, [&](size_t index, const Ant&) {
+    first = std::min(first, index);
+    return true;
+  });
+  return first;
+}
+
+auto Population::refresh_spatial_index() -> void {
+  if (_spatialIndexDirty || _spatialIndex.size() != _ants.size()) {
+    update_spatial_index();
+  }
+}
+
 auto Population::to_json() const -> nlohmann::json {
   nlohmann::json j;
   j["size"] = _size;
@@ -178,6 +283,62 @@ auto Population::get_fitness_data() const -> const FitnessData& {
   return _fitnessData;
 }
 
+auto Population::get_history(HistorySeries series) const -> const History& {
+  return _history[series];
+}
+
+auto Population::get_pangenome() const -> const Pangenome& {
+  return _pangenome;
+}
+
+auto Population::get_output_cache_stats() const -> Inference::OutputCache::Stats {
+  Inference::OutputCache::Stats stats;
+  for (const Ant& ant : _ants) {
+    stats += ant.get_brain().get_network().get_output_cache_stats();
+  }
+  return stats;
+}
+
+auto Population::get_mean_sparsity() const -> float {
+  if (_ants.empty()) {
+    return 0.0F;
+  }
+  float sparsity = 0.0F;
+  for (const Ant& ant : _ants) {
+    sparsity += ant.get_brain().get_network().get_sparsity();
+  }
+  return sparsity / static_cast<float>(_ants.size());
+}
+
+auto Population::get_ant(size_t index) -> Ant& {
+  return _ants.at(index);
+}
+
 auto Population::get_ants() -> std::vector<Ant>& {
+  _spatialIndexDirty = true;  // callers may move or replace ants through this reference
   return _ants;
 }
+
+auto Population::get_ants() const -> const std::vector<Ant>& {
+  return _ants;
+}
+
+auto Population::get_ants_memory_usage() const -> Util::MemoryUsage {
+  Util::MemoryUsage usage = Util::MemoryUsage{}.add_each(_ants).add(_living).add(_retiring);
+  return usage += _spatialIndex.memory_usage();
+}
+
+auto Population::get_history_memory_usage() const -> Util::MemoryUsage {
+  Util::MemoryUsage usage;
+  for (const History& history : _history) {
+    usage += history.memory_usage();
+  }
+  return usage;
+}
+
+auto Population::memory_usage() const -> Util::MemoryUsage {
+  Util::MemoryUsage usage = get_ants_memory_usage();
+  usage += _pangenome.memory_usage();
+  usage += _fitnessData.memory_usage();
+  return usage += get_history_memory_usage();
+}
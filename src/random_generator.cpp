@@ -0,0 +1,200 @@
+#include "random_generator.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace {
+constexpr size_t CHUNK_WORDS = 64;  // words generated per pass by the float fills
+
+constexpr auto rotl(uint64_t x, int k) -> uint64_t {
+  return (x << k) | (x >> (64 - k));
+}
+
+// Layer tables of the 128-layer ziggurat for the standard normal (Marsaglia & Tsang, 2000)
+struct Ziggurat {
+  static constexpr size_t LAYERS = 128;
+  static constexpr double R = 3.442619855899;  // start of the tail
+  static constexpr double AREA = 9.91256303526217e-3;
+
+  std::array<uint32_t, LAYERS> k{};  // |draw| below k[i] lies inside layer i's rectangle
+  std::array<float, LAYERS> w{};     // draw to x scale for each layer
+  std::array<float, LAYERS> f{};     // density at each layer's edge
+
+  Ziggurat() {
+    constexpr double m1 = 2147483648.0;
+    double edge = R;
+    double previous = R;
+    const double q = AREA / std::exp(-0.5 * edge * edge);
+    k[0] = static_cast<uint32_t>((edge / q) * m1);
+    k[1] = 0;
+    w[0] = static_cast<float>(q / m1);
+    w[LAYERS - 1] = static_cast<float>(edge / m1);
+    f[0] = 1.0F;
+    f[LAYERS - 1] = static_cast<float>(std::exp(-0.5 * edge * edge));
+    for (size_t i = LAYERS - 2; i >= 1; --i) {
+      edge = std::sqrt(-2.0 * std::log(AREA / edge + std::exp(-0.5 * edge * edge)));
+      k[i + 1] = static_cast<uint32_t>((edge / previous) * m1);
+      previous = edge;
+      f[i] = static_cast<float>(std::exp(-0.5 * edge * edge));
+      w[i] = static_cast<float>(edge / m1);
+    }
+  }
+};
+
+auto ziggurat() -> const Ziggurat& {
+  static const Ziggurat tables;
+  return tables;
+}
+
+auto magnitude(int32_t draw) -> uint32_t {
+  return draw < 0 ? 0U - static_cast<uint32_t>(draw) : static_cast<uint32_t>(draw);
+}
+
+auto unit_float(uint64_t bits) -> float {
+  return static_cast<float>(bits >> 40) * 0x1.0p-24F;
+}
+}  // namespace
+
+void RandomGenerator::seed_lanes() const {
+  // Each lane starts from an independent SplitMix64 expansion of a fresh word of gen
+  for (size_t lane = 0; lane < LANES; ++lane) {
+    XoshiroCpp::SplitMix64 seeder(gen());
+    lanes.s0[lane] = seeder();
+    lanes.s1[lane] = seeder();
+    lanes.s2[lane] = seeder();
+    lanes.s3[lane] = seeder();
+  }
+  lanes.seeded = true;
+}
+
+void RandomGenerator::fill_bits(std::span<uint64_t> out) const {
+  if (!lanes.seeded) {
+    seed_lanes();
+  }
+  Lane s0 = lanes.s0;
+  Lane s1 = lanes.s1;
+  Lane s2 = lanes.s2;
+  Lane s3 = lanes.s3;
+
+  // One xoshiro256++ step per lane; the lanes are independent so this loop is SIMD
+  const auto step = [&](uint64_t* block) {
+    for (size_t lane = 0; lane < LANES; ++lane) {
+      block[lane] = rotl(s0[lane] + s3[lane], 23) + s0[lane];
+      const uint64_t t = s1[lane] << 17;
+      s2[lane] ^= s0[lane];
+      s3[lane] ^= s1[lane];
+      s1[lane] ^= s2[lane];
+      s0[lane] ^= s3[lane];
+      s2[lane] ^= t;
+      s3[lane] = rotl(s3[lane], 45);
+    }
+  };
+
+  size_t offset = 0;
+  for (; offset + LANES <= out.size(); offset += LANES) {
+    step(out.data() + offset);
+  }
+  if (offset < out.size()) {
+    Lane block;
+    step(block.data());
+    std::copy_n(block.begin(), out.size() - offset, out.begin() + offset);
+  }
+
+  lanes.s0 = s0;
+  lanes.s1 = s1;
+  lanes.s2 = s2;
+  lanes.s3 = s3;
+}
+
+void RandomGenerator::fill_uniform(std::span<float> out, float min, float max) const {
+  std::array<uint64_t, CHUNK_WORDS> words;
+  const float range = max - min;
+  for (size_t offset = 0; offset < out.size(); offset += 2 * CHUNK_WORDS) {
+    const size_t count = std::min(2 * CHUNK_WORDS, out.size() - offset);
+    const size_t wordCount = (count + 1) / 2;
+    fill_bits(std::span(words).first(wordCount));
+    float* values = out.data() + offset;
+    if (count == 2 * CHUNK_WORDS) {
+      // Each word yields its high 24 bits and the 24 below them
+      for (size_t index = 0; index < CHUNK_WORDS; ++index) {
+        values[2 * index] = min + range * unit_float(words[index]);
+        values[2 * index + 1] = min + range * unit_float(words[index] << 24);
+      }
+    } else {
+      for (size_t index = 0; index < count; ++index) {
+        const uint64_t word = words[index / 2];
+        values[index] = min + range * unit_float((index & 1U) != 0 ? word << 24 : word);
+      }
+    }
+  }
+}
+
+float RandomGenerator::normal_tail(int32_t draw, size_t layer) const {
+  const Ziggurat& z = ziggurat();
+  for (;;) {
+    const float x = static_cast<float>(draw) * z.w[layer];
+    if (layer == 0) {
+      // Base layer: sample the tail beyond R directly
+      float tail = 0.0F;
+      float y = 0.0F;
+      do {
+        tail = -std::log(1.0F - unit_float(gen())) / static_cast<float>(Ziggurat::R);
+        y = -std::log(1.0F - unit_float(gen()));
+      } while (y + y < tail * tail);
+      const float value = static_cast<float>(Ziggurat::R) + tail;
+      return draw > 0 ? value : -value;
+    }
+    // Wedge between the layer's rectangle and the curve
+    const float density = z.f[layer] + unit_float(gen()) * (z.f[layer - 1] - z.f[layer]);
+    if (density < std::exp(-0.5F * x * x)) {
+      return x;
+    }
+    draw = static_cast<int32_t>(static_cast<uint32_t>(gen()));
+    layer = static_cast<uint32_t>(draw) & (Ziggurat::LAYERS - 1);
+    if (magnitude(draw) < z.k[layer]) {
+      return static_cast<float>(draw) * z.w[layer];
+    }
+  }
+}
+
+void RandomGenerator::fill_normal(std::span<float> out, float mean, float stddev) const {
+  const Ziggurat& z = ziggurat();
+  std::array<uint64_t, CHUNK_WORDS> words;
+  for (size_t offset = 0; offset < out.size(); offset += 2 * CHUNK_WORDS) {
+    const size_t count = std::min(2 * CHUNK_WORDS, out.size() - offset);
+    fill_bits(std::span(words).first((count + 1) / 2));
+    for (size_t index = 0; index < count; ++index) {
+      const uint64_t word = words[index / 2];
+      const auto draw = static_cast<int32_t>(static_cast<uint32_t>(word >> (32 * (index & 1U))));
+      const size_t layer = static_cast<uint32_t>(draw) & (Ziggurat::LAYERS - 1);
+      const float value = magnitude(draw) < z.k[layer] ? static_cast<float>(draw) * z.w[layer]
+                                                       : normal_tail(draw, layer);
+      out[offset + index] = mean + stddev * value;
+    }
+  }
+}
+
+uint64_t RandomGenerator::bernoulli_mask(double p) const {
+  constexpr uint32_t ONE = 1U << 16;
+  const double scaled = std::round(std::clamp(p, 0.0, 1.0) * ONE);
+  const auto threshold = static_cast<uint32_t>(scaled);
+  if (threshold == 0) {
+    return 0;
+  }
+  if (threshold == ONE) {
+    return ~uint64_t{0};
+  }
+
+  // Walking the binary digits of p from the lowest set one upwards, OR-ing in a random word
+  // for a 1 digit and AND-ing for a 0 digit gives each bit the probability 0.b15...b0
+  const int lowest = std::countr_zero(threshold);
+  std::array<uint64_t, 16> words;
+  fill_bits(std::span(words).first(16 - lowest));
+  uint64_t mask = 0;
+  for (int digit = lowest; digit < 16; ++digit) {
+    const uint64_t word = words[digit - lowest];
+    mask = ((threshold >> digit) & 1U) != 0 ? (mask | word) : (mask & word);
+  }
+  return mask;
+}
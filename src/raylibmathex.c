@@ -36,4 +36,38 @@ bool IsRectContained(Rectangle inner, Rectangle outer) {
            (inner.y >= outer.y) &&
            (inner.x + inner.width <= outer.x + outer.width) &&
            (inner.y + inner.height <= outer.y + outer.height);
-}
\ No newline at end of file
+}
+
+Rectangle GetCameraViewRect(Camera2D camera, int screenWidth, int screenHeight) {
+  // Map all four screen corners so a rotated camera still yields a covering rectangle
+  const Vector2 corners[4] = {
+      GetScreenToWorld2D((Vector2){0.0F, 0.0F}, camera),
+      GetScreenToWorld2D((Vector2){(float)screenWidth, 0.0F}, camera),
+      GetScreenToWorld2D((Vector2){0.0F, (float)screenHeight}, camera),
+      GetScreenToWorld2D((Vector2){(float)screenWidth, (float)screenHeight}, camera)};
+
+  Vector2 min = corners[0];
+  Vector2 max = corners[0];
+  for (int i = 1; i < 4; i++) {
+    min.x = fminf(min.x, corners[i].x);
+    min.y = fminf(min.y, corners[i].y);
+    max.x = fmaxf(max.x, corners[i].x);
+    max.y = fmaxf(max.y, corners[i].y);
+  }
+
+  Rectangle view;
+  view.x = min.x;
+  view.y = min.y;
+  view.width = max.x - min.x;
+  view.height = max.y - min.y;
+  return view;
+}
+
+Rectangle ExpandRect(Rectangle rectangle, float margin) {
+  Rectangle expanded;
+  expanded.x = rectangle.x - margin;
+  expanded.y = rectangle.y - margin;
+  expanded.width = rectangle.width + 2.0F * margin;
+  expanded.height = rectangle.height + 2.0F * margin;
+  return expanded;
+}
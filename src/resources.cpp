@@ -1,7 +1,12 @@
 #include "resources.hpp"
 
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
 #include "food.hpp"
+#include "population.hpp"
 #include "raylib.h"
+#include "raylibmathex.h"
 #include "world.hpp"
 
 Resources::Resources(World& world) : _world(world) {
@@ -14,17 +19,20 @@ Resources::Resources(const nlohmann::json& json, World& world) : _world(world) {
   for (const auto& food_json : json.at("food")) {
     _food.push_back(Food(food_json, _world.get_texture_cache()));
   }
+  update_spatial_index();
 }
 
 Resources::Resources(const Resources& other) : _world(other._world) {
   _food_count = other._food_count;
   _food = other._food;
+  _foodIndex = other._foodIndex;
 }
 
 Resources& Resources::operator=(const Resources& other) {
   if (this != &other) {
     _food_count = other._food_count;
     _food = other._food;
+    _foodIndex = other._foodIndex;
   }
   return *this;
 }
@@ -38,33 +46,70 @@ auto Resources::update(float time) -> void {
   while (_food.size() < _food_count)
     _food.push_back(Food(_world.spawn_position({Food::TEXTURE_WIDTH, Food::TEXTURE_HEIGHT}), _world.get_texture_cache()));
 
-  feed_ants(_world.get_population());
+  respawn_food();
 }
 
-auto Resources::draw() const -> void {
-  for (const auto& food : _food) {
-    food.draw();
-  }
+auto Resources::draw(const Rectangle& view, bool dots) const -> void {
+  _foodIndex.query(ExpandRect(view, Food::RADIUS), [&](size_t index) {
+    if (index >= _food.size()) {
+      return;
+    }
+    if (dots) {
+      _food[index].draw_dot();
+    } else {
+      _food[index].draw();
+    }
+  });
 }
 
-auto Resources::feed_ants(Population& population) -> void {
+auto Resources::respawn_food() -> void {
   for (Food& food : _food) {
     if (food.is_eaten()) {
       food.reset(_world.spawn_position({Food::TEXTURE_WIDTH, Food::TEXTURE_HEIGHT}));
       // Randomize sprite when food respawns
       food.set_texture_index(_world.get_texture_cache().get_random_texture_index("food_"));
     }
+  }
+  update_spatial_index();
+}
 
-    auto ants = population.get_collisions(food.get_position(), food.get_radius());
-
-    if (ants.size() == 0)
-      continue;
-
-    for (auto& ant : ants) {
-      food.eat(ant.get());
-      break;  // Only one ant can eat the food at a time
+auto Resources::generate_contacts(Population& population) -> std::span<const Contact> {
+  if (_foodIndex.size() != _food.size()) {
+    update_spatial_index();
+  }
+  population.refresh_spatial_index();
+  _contactAnts.assign(_food.size(), Population::NO_ANT);
+
+  // Each piece of food lives in exactly one cell, so the cells write disjoint slots
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, _foodIndex.get_cell_count()),
+                    [&](const tbb::blocked_range<size_t>& range) {
+                      for (size_t cell = range.begin(); cell != range.end(); ++cell) {
+                        _foodIndex.query_cell(cell, [&](size_t index) {
+                          const Food& food = _food[index];
+                          if (!food.is_eaten()) {
+                            _contactAnts[index] =
+                                population.first_contact(food.get_position(), food.get_radius());
+                          }
+                        });
+                      }
+                    });
+
+  // Each piece of food is eaten by at most one ant, so this bounds the contacts of any tick
+  _contacts.clear();
+  _contacts.reserve(_food.size());
+  for (size_t index = 0; index < _contactAnts.size(); ++index) {
+    if (_contactAnts[index] != Population::NO_ANT) {
+      _contacts.push_back({index, _contactAnts[index]});
     }
   }
+  return _contacts;
+}
+
+auto Resources::feed_ants(Population& population) -> void {
+  // Only one ant can eat the food at a time; ties go to the lowest ant index
+  for (const Contact& contact : generate_contacts(population)) {
+    _food[contact.food].eat(population.get_ant(contact.ant));
+  }
 }
 
 auto Resources::get_food_count() const -> int {
@@ -76,12 +121,27 @@ auto Resources::set_food_count(int size) -> void {
 }
 
 auto Resources::food_in_rect(const Rectangle& rect) const -> bool {
-  for (const Food& food : _food) {
-    if (CheckCollisionCircleRec(food.get_position(), food.get_radius(), rect)) {
-      return true;
-    }
-  }
-  return false;
+  bool found = false;
+  _foodIndex.query(ExpandRect(rect, Food::RADIUS), [&](size_t index) {
+    found = index < _food.size() &&
+            CheckCollisionCircleRec(_food[index].get_position(), _food[index].get_radius(), rect);
+    return !found;
+  });
+  return found;
+}
+
+auto Resources::get_food() const -> const std::vector<Food>& {
+  return _food;
+}
+
+auto Resources::memory_usage() const -> Util::MemoryUsage {
+  Util::MemoryUsage usage = Util::MemoryUsage{}.add(_food).add(_contactAnts).add(_contacts);
+  return usage += _foodIndex.memory_usage();
+}
+
+auto Resources::update_spatial_index() -> void {
+  _foodIndex.set_bounds(_world.get_bounds(), INDEX_CELL_SIZE);
+  _foodIndex.build(_food.size(), [&](size_t index) { return _food[index].get_position(); });
 }
 
 auto Resources::to_json() const -> nlohmann::json {
@@ -1,7 +1,34 @@
 #include "surroundings.hpp"
 
+#include <algorithm>
+#include <bit>
 #include <cmath>
 #include <stdexcept>
+#include <string>
+
+namespace {
+// Calls visit(index) for every set bit across masks, in increasing index order
+template <typename Visitor>
+auto for_each_bit(std::span<const Surroundings::Mask> masks, Visitor&& visit) -> void {
+  for (size_t word = 0; word < masks.size(); ++word) {
+    Surroundings::Mask bits = masks[word];
+    while (bits != 0) {
+      visit(word * Surroundings::MASK_BITS + std::countr_zero(bits));
+      bits &= bits - 1;
+    }
+  }
+}
+
+auto low_bits(size_t count) -> Surroundings::Mask {
+  return count >= Surroundings::MASK_BITS ? ~Surroundings::Mask{0}
+                                          : (Surroundings::Mask{1} << count) - 1;
+}
+}  // namespace
+
+auto Surroundings::operator==(const Surroundings& other) const -> bool {
+  return _width == other._width && _height == other._height && _food == other._food &&
+         _wall == other._wall;
+}
 
 auto Surroundings::set_dimensions(size_t width, size_t height) -> void {
   if (width == 0 || height == 0) {
@@ -11,106 +38,185 @@ auto Surroundings::set_dimensions(size_t width, size_t height) -> void {
     throw std::invalid_argument("Width * height must be less than 65536");
   }
 
-  _surroundingsType.resize(height);
-  for (auto& row : _surroundingsType) {
-    row.resize(width, EMPTY);  // Initialize all cells as EMPTY
-  }
-
-  // Resize the encoded vector to match the total number of cells
-  _surroundingsEncoded.resize(width * height);
+  // Every cell starts EMPTY
+  _width = width;
+  _height = height;
+  const size_t words = (width * height + MASK_BITS - 1) / MASK_BITS;
+  _food.assign(words, 0);
+  _wall.assign(words, 0);
 
   // Mark as changed since we've modified the structure
   _changed = true;
+  _encodedStale = true;
+}
+
+auto Surroundings::write_bits(std::vector<Mask>& masks, size_t offset, size_t count, Mask bits)
+    -> bool {
+  // A field of up to 64 bits spans at most two words
+  const size_t word = offset / MASK_BITS;
+  const size_t shift = offset % MASK_BITS;
+  bits &= low_bits(count);
+
+  const Mask lowField = low_bits(count) << shift;
+  const Mask lowOld = masks[word];
+  masks[word] = (lowOld & ~lowField) | (bits << shift);
+  bool changed = masks[word] != lowOld;
+
+  if (shift + count > MASK_BITS) {
+    const Mask highField = low_bits(shift + count - MASK_BITS);
+    const Mask highOld = masks[word + 1];
+    masks[word + 1] = (highOld & ~highField) | (bits >> (MASK_BITS - shift));
+    changed |= masks[word + 1] != highOld;
+  }
+  return changed;
 }
 
 auto Surroundings::set_type(size_t x, size_t y, Type type) -> void {
   // Check bounds (size_t is unsigned, so no need to check < 0)
-  if (_surroundingsType.empty() || y >= _surroundingsType.size() || _surroundingsType[0].empty() ||
-      x >= _surroundingsType[0].size()) {
+  if (y >= _height || x >= _width) {
     throw std::out_of_range("Index out of range");
   }
 
-  bool changed = (_surroundingsType[y][x] != type);
-  if (!changed) {
-    return;
+  const size_t index = y * _width + x;
+  const Mask food = type == FOOD ? 1 : 0;
+  const Mask wall = type == WALL ? 1 : 0;
+  const bool foodChanged = write_bits(_food, index, 1, food);
+  const bool wallChanged = write_bits(_wall, index, 1, wall);
+  if (foodChanged || wallChanged) {
+    _changed = true;
+    _encodedStale = true;
   }
+}
 
-  _changed = true;
-
-  // Set the type and mark as changed
-  _surroundingsType[y][x] = type;
-
-  // Update the encoded vector with this single change
-  // to avoid re-encoding the entire vector
-  // Add bounds check to prevent overflow in multiplication
-  size_t width = get_width();
-  if (y > SIZE_MAX / width || y * width > SIZE_MAX - x) {
-    throw std::overflow_error("Index calculation would overflow");
+auto Surroundings::set_row(size_t y, Mask food, Mask wall) -> void {
+  if (y >= _height) {
+    throw std::out_of_range("Row index out of range");
+  }
+  if (_width > MASK_BITS) {
+    throw std::invalid_argument("Rows wider than " + std::to_string(MASK_BITS) +
+                                " cells must be written with set_type");
+  }
+  if ((food & wall & low_bits(_width)) != 0) {
+    throw std::invalid_argument("A cell cannot be both food and wall");
   }
 
-  size_t index = y * width + x;
-  if (index >= _surroundingsEncoded.size()) {
-    throw std::out_of_range("Calculated index out of range");
+  const bool foodChanged = write_bits(_food, y * _width, _width, food);
+  const bool wallChanged = write_bits(_wall, y * _width, _width, wall);
+  if (foodChanged || wallChanged) {
+    _changed = true;
+    _encodedStale = true;
   }
+}
 
-  _surroundingsEncoded[index] = encode_type(type);
+auto Surroundings::get_type(size_t x, size_t y) const -> Type {
+  if (y >= _height || x >= _width) {
+    throw std::out_of_range("Index out of range");
+  }
+  const size_t index = y * _width + x;
+  const Mask bit = Mask{1} << (index % MASK_BITS);
+  if ((_food[index / MASK_BITS] & bit) != 0) {
+    return FOOD;
+  }
+  if ((_wall[index / MASK_BITS] & bit) != 0) {
+    return WALL;
+  }
+  return EMPTY;
 }
 
 auto Surroundings::get_dimensions() const -> Vector2 {
-  if (_surroundingsType.empty()) {
-    return {0, 0};
-  }
-  return {static_cast<float>(_surroundingsType[0].size()),
-          static_cast<float>(_surroundingsType.size())};
+  return {static_cast<float>(_width), static_cast<float>(_height)};
 }
 
-auto Surroundings::update_encoded_surroundings() -> void {
-  // Check for overflow in width * height calculation
-  size_t width = get_width();
-  size_t height = get_height();
-  if (width > 0 && height > SIZE_MAX / width) {
-    throw std::overflow_error("Width * height would overflow in update_encoded_surroundings");
+auto Surroundings::get_food_mask() const -> std::span<const Mask> {
+  return _food;
+}
+
+auto Surroundings::get_wall_mask() const -> std::span<const Mask> {
+  return _wall;
+}
+
+auto Surroundings::diff(const Surroundings& other, std::span<Mask> out) const -> size_t {
+  if (_width != other._width || _height != other._height) {
+    throw std::invalid_argument("Cannot diff surroundings of different dimensions");
+  }
+  if (out.size() != _food.size()) {
+    throw std::invalid_argument("Diff output has " + std::to_string(out.size()) +
+                                " words, expected " + std::to_string(_food.size()));
   }
 
-  // Resize the encoded vector to match the total number of cells
-  _surroundingsEncoded.resize(width * height);
+  size_t count = 0;
+  for (size_t word = 0; word < _food.size(); ++word) {
+    out[word] = (_food[word] ^ other._food[word]) | (_wall[word] ^ other._wall[word]);
+    count += std::popcount(out[word]);
+  }
+  return count;
+}
 
-  // Encode the surroundings
-  size_t index = 0;
-  for (const auto& row : _surroundingsType) {
-    for (const auto& type : row) {
-      _surroundingsEncoded[index++] = encode_type(type);
-    }
+auto Surroundings::hash() const -> size_t {
+  // splitmix64 finalizer folded over the dimensions and both masks
+  auto mix = [](uint64_t value) {
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+    return value ^ (value >> 31);
+  };
+  uint64_t hash = mix((static_cast<uint64_t>(_width) << 32) | _height);
+  for (size_t word = 0; word < _food.size(); ++word) {
+    hash = mix(hash ^ _food[word]);
+    hash = mix(hash ^ _wall[word]);
   }
-  _changed = false;
+  return static_cast<size_t>(hash);
+}
+
+auto Surroundings::update_encoded_surroundings() -> void {
+  _surroundingsEncoded.resize(_width * _height);
+  encode(_surroundingsEncoded);
+  _encodedStale = false;
 }
 
 auto Surroundings::get_encoded_surroundings() -> const std::vector<Neuron::Value>& {
   // If the surroundings haven't changed, return the cached encoded vector
-  if (!_changed) {
-    return _surroundingsEncoded;
+  if (_encodedStale) {
+    update_encoded_surroundings();
   }
-
-  update_encoded_surroundings();
+  _changed = false;
 
   return _surroundingsEncoded;
 }
 
-auto Surroundings::get_width() const -> size_t {
-  if (_surroundingsType.empty())
-    return 0;
+auto Surroundings::encode(std::span<Neuron::Value> out) -> void {
+  if (out.size() != _width * _height) {
+    throw std::invalid_argument("Encoded output size " + std::to_string(out.size()) +
+                                " does not match " + std::to_string(_width * _height) +
+                                " surroundings cells");
+  }
+
+  // Most cells are empty, so clear everything and only visit the set bits
+  std::ranges::fill(out, encode_type(EMPTY));
+  for_each_bit(_food, [&](size_t index) { out[index] = encode_type(FOOD); });
+  for_each_bit(_wall, [&](size_t index) { out[index] = encode_type(WALL); });
+  _changed = false;
+}
 
-  return _surroundingsType[0].size();
+auto Surroundings::get_width() const -> size_t {
+  return _width;
 }
 
 auto Surroundings::get_height() const -> size_t {
-  return _surroundingsType.size();
+  return _height;
 }
 
 auto Surroundings::changed() const -> bool {
   return _changed;
 }
 
+auto Surroundings::clear_changed() -> void {
+  _changed = false;
+}
+
+auto Surroundings::memory_usage() const -> Util::MemoryUsage {
+  return Util::MemoryUsage{}.add(_food).add(_wall).add(_surroundingsEncoded);
+}
+
 auto Surroundings::encode_type(Type type) -> float {
   switch (type) {
     case FOOD:
@@ -122,4 +228,4 @@ auto Surroundings::encode_type(Type type) -> float {
     default:
       return 0.0f;  // Default case for safety
   }
-}
\ No newline at end of file
+}
@@ -0,0 +1,126 @@
+#include <cstdlib>
+#include <new>
+
+#include "util/allocation_counter.hpp"
+
+/*  The counting replacement for the global operator new and delete. It is linked into the unit
+    tests and benchmarks only, so the game keeps the standard allocator and its counts stay
+    zero.
+*/
+
+namespace {
+// Marks the counts as real before main() runs
+const bool enabled = [] {
+  Util::AllocationCounter::enable();
+  return true;
+}();
+
+auto allocate(std::size_t size) -> void* {
+  Util::AllocationCounter::record(size);
+  return std::malloc(size == 0 ? 1 : size);
+}
+
+auto allocate_aligned(std::size_t size, std::align_val_t alignment) -> void* {
+  Util::AllocationCounter::record(size);
+  const auto align = static_cast<std::size_t>(alignment);
+  // aligned_alloc wants a non-zero multiple of the alignment
+  const std::size_t rounded = size == 0 ? align : (size + align - 1) / align * align;
+  return std::aligned_alloc(align, rounded);
+}
+
+// Retries through the new handler like the standard operator new, throwing without one
+template <typename Allocate>
+auto allocate_or_throw(Allocate&& allocate) -> void* {
+  while (true) {
+    if (void* pointer = allocate()) {
+      return pointer;
+    }
+    std::new_handler handler = std::get_new_handler();
+    if (handler == nullptr) {
+      throw std::bad_alloc();
+    }
+    handler();
+  }
+}
+}  // namespace
+
+void* operator new(std::size_t size) {
+  return allocate_or_throw([&] { return allocate(size); });
+}
+
+void* operator new[](std::size_t size) {
+  return allocate_or_throw([&] { return allocate(size); });
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+  return allocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+  return allocate(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+  return allocate_or_throw([&] { return allocate_aligned(size, alignment); });
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+  return allocate_or_throw([&] { return allocate_aligned(size, alignment); });
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+  return allocate_aligned(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment,
+                     const std::nothrow_t&) noexcept {
+  return allocate_aligned(size, alignment);
+}
+
+void operator delete(void* pointer) noexcept {
+  std::free(pointer);
+}
+
+void operator delete[](void* pointer) noexcept {
+  std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+  std::free(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept {
+  std::free(pointer);
+}
+
+void operator delete(void* pointer, const std::nothrow_t&) noexcept {
+  std::free(pointer);
+}
+
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept {
+  std::free(pointer);
+}
+
+void operator delete(void* pointer, std::align_val_t) noexcept {
+  std::free(pointer);
+}
+
+void operator delete[](void* pointer, std::align_val_t) noexcept {
+  std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t, std::align_val_t) noexcept {
+  std::free(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t, std::align_val_t) noexcept {
+  std::free(pointer);
+}
+
+void operator delete(void* pointer, std::align_val_t, const std::nothrow_t&) noexcept {
+  std::free(pointer);
+}
+
+void operator delete[](void* pointer, std::align_val_t, const std::nothrow_t&) noexcept {
+  std::free(pointer);
+}
@@ -1,14 +1,134 @@
 #include "tests/helpers/benchmark_reporter.hpp"
 
 #include <sys/utsname.h>
+#include <tbb/global_control.h>
 
 #include <algorithm>
+#include <array>
+#include <catch2/catch_test_macros.hpp>
 #include <cmath>
+#include <cstdlib>
+#include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <limits>
 #include <numeric>
+#include <random_generator.hpp>
+#include <thread>
 #include <vector>
 
+namespace {
+auto environment_value(const char* name, double fallback) -> double {
+  const char* value = std::getenv(name);
+  if (value == nullptr) {
+    return fallback;
+  }
+  try {
+    return std::stod(value);
+  } catch (const std::exception&) {
+    std::cerr << "Ignoring invalid " << name << "=" << value << "\n";
+    return fallback;
+  }
+}
+
+// Value of the first "key : value" line in /proc/cpuinfo, empty when there is none
+auto cpuinfo_value(const std::string& key) -> std::string {
+  std::ifstream cpuinfo("/proc/cpuinfo");
+  std::string line;
+  while (std::getline(cpuinfo, line)) {
+    const size_t colon = line.find(':');
+    if (colon == std::string::npos || !line.starts_with(key)) {
+      continue;
+    }
+    const size_t start = line.find_first_not_of(' ', colon + 1);
+    return start == std::string::npos ? std::string() : line.substr(start);
+  }
+  return {};
+}
+
+// The CPU features the SIMD paths care about, as reported by the running machine
+auto cpu_features() -> std::vector<std::string> {
+  static const char* const INTERESTING[] = {"sse4_2",  "avx",      "avx2",     "fma",
+                                            "f16c",    "bmi2",     "avx512f",  "avx512bw",
+                                            "avx512vl", "avx512_vnni", "avx_vnni"};
+  std::vector<std::string> flags;
+  std::stringstream line(cpuinfo_value("flags"));
+  for (std::string flag; line >> flag;) {
+    flags.push_back(flag);
+  }
+
+  std::vector<std::string> present;
+  for (const char* feature : INTERESTING) {
+    if (std::find(flags.begin(), flags.end(), feature) != flags.end()) {
+      present.emplace_back(feature);
+    }
+  }
+  return present;
+}
+
+// The instruction sets this binary was compiled to use
+auto compiled_isa() -> std::vector<std::string> {
+  std::vector<std::string> isa;
+#if defined(__SSE4_2__)
+  isa.emplace_back("sse4_2");
+#endif
+#if defined(__AVX__)
+  isa.emplace_back("avx");
+#endif
+#if defined(__AVX2__)
+  isa.emplace_back("avx2");
+#endif
+#if defined(__FMA__)
+  isa.emplace_back("fma");
+#endif
+#if defined(__F16C__)
+  isa.emplace_back("f16c");
+#endif
+#if defined(__AVX512F__)
+  isa.emplace_back("avx512f");
+#endif
+#if defined(__AVX512BW__)
+  isa.emplace_back("avx512bw");
+#endif
+#if defined(__AVX512VNNI__)
+  isa.emplace_back("avx512_vnni");
+#endif
+  return isa;
+}
+
+// Mean count per iteration of every event that was counted in all samples
+auto counter_means(const std::vector<PerfCounters::Sample>& samples)
+    -> std::array<std::optional<double>, PerfCounters::EVENT_COUNT> {
+  std::array<std::optional<double>, PerfCounters::EVENT_COUNT> means{};
+  if (samples.empty()) {
+    return means;
+  }
+  for (size_t event = 0; event < PerfCounters::EVENT_COUNT; ++event) {
+    double sum = 0.0;
+    bool valid = true;
+    for (const PerfCounters::Sample& sample : samples) {
+      valid = valid && sample.valid[event];
+      sum += static_cast<double>(sample.values[event]);
+    }
+    if (valid) {
+      means[event] = sum / static_cast<double>(samples.size());
+    }
+  }
+  return means;
+}
+
+auto git_revision() -> std::string {
+  if (const char* revision = std::getenv("BENCHMARK_GIT_REVISION")) {
+    return revision;
+  }
+#if defined(NEURAL_ANTS_GIT_REVISION)
+  return NEURAL_ANTS_GIT_REVISION;
+#else
+  return "unknown";
+#endif
+}
+}  // namespace
+
 BenchmarkReporter::BenchmarkReporter(const std::string& title, const std::string& output_file)
     : _title(title), _output_file(output_file) {}
 
@@ -20,9 +140,66 @@ auto BenchmarkReporter::set_data(const std::vector<double>& data) -> void {
   _raw_data = data;
 }
 
+auto BenchmarkReporter::set_scaling_runs(const std::vector<ScalingRun>& runs) -> void {
+  _scaling_runs = runs;
+}
+
+auto BenchmarkReporter::set_histogram(const LatencyHistogram& histogram) -> void {
+  _histogram = histogram;
+}
+
+auto BenchmarkReporter::set_counters(const CounterReport& counters) -> void {
+  _counters = counters;
+}
+
+auto BenchmarkReporter::set_allocations(const AllocationReport& allocations) -> void {
+  _allocations = allocations;
+}
+
+auto BenchmarkReporter::set_memory(const MemoryReport& memory) -> void {
+  _memory = memory;
+}
+
 auto BenchmarkReporter::generate_report() -> void {
   calculate_statistics();
 
+  _json = nlohmann::json::object();
+  _json["title"] = _title;
+  _json["unit"] = "ns";
+  _json["samples"] = _raw_data;
+  _json["statistics"] = {{"count", _raw_data.size()}, {"mean", _mean},   {"median", _median},
+                         {"std_dev", _std_dev},       {"min", _min},     {"max", _max}};
+  _json["environment"] = environment_json();
+  if (!_scaling_runs.empty()) {
+    nlohmann::json scaling = nlohmann::json::array();
+    for (const ScalingRun& run : _scaling_runs) {
+      scaling.push_back({{"threads", run.threads}, {"samples", run.data}});
+    }
+    _json["scaling"] = scaling;
+  }
+  _json["outliers"] = {{"mild", _mild_outliers}, {"severe", _severe_outliers}};
+  if (_histogram) {
+    _json["latency"] = {{"count", _histogram->count()},
+                        {"discarded", _histogram->get_discarded()},
+                        {"mean", _histogram->mean()},
+                        {"min", _histogram->min()},
+                        {"p50", _histogram->percentile(50.0)},
+                        {"p90", _histogram->percentile(90.0)},
+                        {"p99", _histogram->percentile(99.0)},
+                        {"p99_9", _histogram->percentile(99.9)},
+                        {"max", _histogram->max()}};
+  }
+  if (_counters) {
+    _json["counters"] = counters_json();
+  }
+  if (_allocations) {
+    _json["allocations"] = allocations_json();
+  }
+  if (_memory) {
+    _json["memory"] = memory_json();
+  }
+  const nlohmann::json& environment = _json["environment"];
+
   std::stringstream report;
   report << "# " << _title << "\n\n";
 
@@ -30,38 +207,210 @@ auto BenchmarkReporter::generate_report() -> void {
   report << "## Test Environment\n";
   report << "- Date: " << get_timestamp() << "\n";
   report << "- System: " << get_system_info() << "\n";
-  report << "- Compiler: " << get_compiler_info() << "\n\n";
+  report << "- CPU: " << environment["cpu_model"].get<std::string>() << "\n";
+  report << "- Compiler: " << get_compiler_info() << "\n";
+  report << "- Git revision: " << environment["git_revision"].get<std::string>() << "\n";
+  report << "- Threads: " << environment["tbb_threads"] << " of "
+         << environment["hardware_threads"] << "\n\n";
 
   // Statistical Summary
-  report << "## Statistical Summary\n\n";
-  report << format_markdown_table();
+  if (!_raw_data.empty() || !_histogram) {
+    report << "## Statistical Summary\n\n";
+    report << format_markdown_table();
+  }
+
+  if (_histogram) {
+    report << "\n## Latency Percentiles\n\n";
+    report << format_histogram_table();
+  }
+
+  if (_counters) {
+    report << "\n## Hardware Counters\n\n";
+    report << format_counter_table();
+  }
+
+  if (_allocations) {
+    report << "\n## Heap Allocations\n\n";
+    report << format_allocation_table();
+  }
+
+  if (_memory) {
+    report << "\n## Memory Footprint\n\n";
+    report << format_memory_table();
+  }
+
+  if (!_scaling_runs.empty()) {
+    report << "\n## Thread Scaling\n\n";
+    report << format_scaling_table();
+  }
+
+  const std::string comparison = compare_to_baseline();
+  if (!comparison.empty()) {
+    report << "\n## Baseline Comparison\n\n";
+    report << comparison;
+  }
 
   // Raw Data
-  report << "\n## Raw Data\n\n";
-  report << format_raw_data_table();
+  if (!_raw_data.empty() || !_histogram) {
+    report << "\n## Raw Data\n\n";
+    report << format_raw_data_table();
+  }
 
   _report_content = report.str();
 }
 
 auto BenchmarkReporter::write_to_file() -> void {
-  std::ofstream file(_output_file);
+  const std::string report_path = output_path(_output_file);
+  std::ofstream file(report_path);
   if (!file.is_open()) {
-    std::cerr << "Error: Could not open file " << _output_file << " for writing\n";
+    std::cerr << "Error: Could not open file " << report_path << " for writing\n";
     return;
   }
 
   file << _report_content;
   file.close();
 
-  std::cout << "Benchmark report written to: " << _output_file << std::endl;
+  const std::string json_path =
+      output_path(std::filesystem::path(_output_file).replace_extension(".json").string());
+  std::ofstream json_file(json_path);
+  if (json_file.is_open()) {
+    json_file << _json.dump(2) << "\n";
+  } else {
+    std::cerr << "Error: Could not open file " << json_path << " for writing\n";
+  }
+
+  std::cout << "Benchmark report written to: " << report_path << std::endl;
+
+  if (_regression) {
+    FAIL_CHECK("Benchmark regression: " << _title << " (see " << report_path << ")");
+  }
+}
+
+auto BenchmarkReporter::to_json() const -> const nlohmann::json& {
+  return _json;
+}
+
+auto BenchmarkReporter::has_regression() const -> bool {
+  return _regression;
+}
+
+auto BenchmarkReporter::output_path(const std::string& file_name) -> std::string {
+  const char* directory = std::getenv("BENCHMARK_OUTPUT_DIR");
+  if (directory == nullptr || *directory == '\0') {
+    return file_name;
+  }
+  std::error_code error;
+  std::filesystem::create_directories(directory, error);
+  return (std::filesystem::path(directory) / std::filesystem::path(file_name).filename()).string();
+}
+
+auto BenchmarkReporter::compare_to_baseline() -> std::string {
+  _regression = false;
+  const char* directory = std::getenv("BENCHMARK_BASELINE_DIR");
+  if (directory == nullptr || *directory == '\0') {
+    return {};
+  }
+
+  const std::filesystem::path baseline_path =
+      std::filesystem::path(directory) /
+      std::filesystem::path(_output_file).filename().replace_extension(".json");
+  std::ifstream baseline_file(baseline_path);
+  if (!baseline_file.is_open()) {
+    _json["comparison"] = {{"baseline", baseline_path.string()}, {"status", "missing"}};
+    return "No baseline at " + baseline_path.string() + "\n";
+  }
+
+  std::vector<double> baseline;
+  try {
+    baseline = nlohmann::json::parse(baseline_file).at("samples").get<std::vector<double>>();
+  } catch (const std::exception& error) {
+    _json["comparison"] = {{"baseline", baseline_path.string()}, {"status", "invalid"}};
+    return "Unreadable baseline at " + baseline_path.string() + ": " + error.what() + "\n";
+  }
+  if (baseline.empty() || _raw_data.empty()) {
+    _json["comparison"] = {{"baseline", baseline_path.string()}, {"status", "empty"}};
+    return "No samples to compare with " + baseline_path.string() + "\n";
+  }
+
+  const double threshold = environment_value("BENCHMARK_REGRESSION_THRESHOLD", 0.05);
+  const double significance = environment_value("BENCHMARK_SIGNIFICANCE", 0.01);
+  const double baseline_median = StatisticalBenchmarkRunner::calculate_median(baseline);
+  const double ratio = baseline_median > 0.0 ? _median / baseline_median : 1.0;
+  const double p_value = StatisticalBenchmarkRunner::mann_whitney_p(baseline, _raw_data);
+  const auto [ci_low, ci_high] =
+      StatisticalBenchmarkRunner::bootstrap_median_ratio(baseline, _raw_data);
+
+  // A regression must be both large enough to matter and unlikely to be noise
+  _regression = ratio > 1.0 + threshold && p_value < significance;
+  const bool improvement = ratio < 1.0 - threshold && p_value < significance;
+  const std::string verdict =
+      _regression ? "regression" : (improvement ? "improvement" : "unchanged");
+
+  _json["comparison"] = {{"baseline", baseline_path.string()},
+                         {"status", verdict},
+                         {"baseline_median", baseline_median},
+                         {"median_ratio", ratio},
+                         {"median_ratio_ci95", {ci_low, ci_high}},
+                         {"mann_whitney_p", p_value},
+                         {"threshold", threshold},
+                         {"significance", significance}};
+
+  std::string unit = determine_best_unit();
+  std::stringstream table;
+  table << "| Metric | Value |\n";
+  table << "|--------|-------|\n";
+  table << "| Baseline Median (" << unit << ") | " << std::fixed << std::setprecision(2)
+        << convert_to_best_unit(baseline_median) << " |\n";
+  table << "| Median (" << unit << ") | " << convert_to_best_unit(_median) << " |\n";
+  table << "| Change | " << std::showpos << (ratio - 1.0) * 100.0 << std::noshowpos << "% |\n";
+  table << "| Median Ratio 95% CI | " << std::setprecision(3) << ci_low << " - " << ci_high
+        << " |\n";
+  table << "| Mann-Whitney U p | " << std::setprecision(4) << p_value << " |\n";
+  table << "| Verdict | " << verdict << " |\n";
+  return table.str();
+}
+
+auto BenchmarkReporter::environment_json() -> nlohmann::json {
+  const std::string cpu_model = cpuinfo_value("model name");
+  return {
+      {"timestamp", get_timestamp()},
+      {"system", get_system_info()},
+      {"cpu_model", cpu_model.empty() ? "unknown" : cpu_model},
+      {"cpu_features", cpu_features()},
+      {"compiled_isa", compiled_isa()},
+      {"compiler", get_compiler_info()},
+#if defined(__OPTIMIZE__)
+      {"optimized", true},
+#else
+      {"optimized", false},
+#endif
+#if defined(__FAST_MATH__)
+      {"fast_math", true},
+#else
+      {"fast_math", false},
+#endif
+#if defined(NDEBUG)
+      {"assertions", false},
+#else
+      {"assertions", true},
+#endif
+      {"git_revision", git_revision()},
+      {"hardware_threads", std::thread::hardware_concurrency()},
+      {"tbb_threads",
+       tbb::global_control::active_value(tbb::global_control::max_allowed_parallelism)},
+  };
 }
 
 auto BenchmarkReporter::calculate_statistics() -> void {
+  _mild_outliers.clear();
+  _severe_outliers.clear();
   if (_raw_data.empty()) {
-    _mean = _std_dev = _min = _max = 0.0;
+    _median = _mean = _std_dev = _min = _max = 0.0;
     return;
   }
 
+  find_outliers();
+  _median = StatisticalBenchmarkRunner::calculate_median(_raw_data);
   _mean = StatisticalBenchmarkRunner::calculate_mean(_raw_data);
   _std_dev = StatisticalBenchmarkRunner::calculate_std_dev(_raw_data, _mean);
   _min = StatisticalBenchmarkRunner::get_min(_raw_data);
@@ -77,12 +426,185 @@ auto BenchmarkReporter::format_markdown_table() -> std::string {
   table << "| Iterations | " << _raw_data.size() << " |\n";
   table << "| Mean (" << unit << ") | " << std::fixed << std::setprecision(2)
         << convert_to_best_unit(_mean) << " |\n";
+  table << "| Median (" << unit << ") | " << std::fixed << std::setprecision(2)
+        << convert_to_best_unit(_median) << " |\n";
   table << "| Std Dev (" << unit << ") | " << std::fixed << std::setprecision(2)
         << convert_to_best_unit(_std_dev) << " |\n";
   table << "| Min (" << unit << ") | " << std::fixed << std::setprecision(2)
         << convert_to_best_unit(_min) << " |\n";
   table << "| Max (" << unit << ") | " << std::fixed << std::setprecision(2)
         << convert_to_best_unit(_max) << " |\n";
+  table << "| Outliers (mild / severe) | " << _mild_outliers.size() << " / "
+        << _severe_outliers.size() << " |\n";
+
+  return table.str();
+}
+
+auto BenchmarkReporter::find_outliers() -> void {
+  const double q1 = StatisticalBenchmarkRunner::calculate_percentile(_raw_data, 25.0);
+  const double q3 = StatisticalBenchmarkRunner::calculate_percentile(_raw_data, 75.0);
+  const double iqr = q3 - q1;
+  for (size_t i = 0; i < _raw_data.size(); ++i) {
+    const double value = _raw_data[i];
+    if (value < q1 - 3.0 * iqr || value > q3 + 3.0 * iqr) {
+      _severe_outliers.push_back(i);
+    } else if (value < q1 - 1.5 * iqr || value > q3 + 1.5 * iqr) {
+      _mild_outliers.push_back(i);
+    }
+  }
+}
+
+auto BenchmarkReporter::format_histogram_table() -> std::string {
+  const LatencyHistogram& histogram = *_histogram;
+  const std::string unit = determine_unit(static_cast<double>(histogram.percentile(50.0)));
+  auto value = [&](uint64_t ns) { return convert_to_unit(static_cast<double>(ns), unit); };
+
+  // Samples beyond the severe outlier fence of the whole distribution
+  const uint64_t p25 = histogram.percentile(25.0);
+  const uint64_t p75 = histogram.percentile(75.0);
+  const uint64_t fence = p75 + 3 * (p75 - p25);
+
+  std::stringstream table;
+  table << "| Metric | Value |\n";
+  table << "|--------|-------|\n";
+  table << "| Samples | " << histogram.count() << " |\n";
+  table << "| Warm-up Discarded | " << histogram.get_discarded() << " |\n";
+  table << std::fixed << std::setprecision(2);
+  table << "| Mean (" << unit << ") | " << convert_to_unit(histogram.mean(), unit) << " |\n";
+  table << "| p50 (" << unit << ") | " << value(histogram.percentile(50.0)) << " |\n";
+  table << "| p90 (" << unit << ") | " << value(histogram.percentile(90.0)) << " |\n";
+  table << "| p99 (" << unit << ") | " << value(histogram.percentile(99.0)) << " |\n";
+  table << "| p99.9 (" << unit << ") | " << value(histogram.percentile(99.9)) << " |\n";
+  table << "| Max (" << unit << ") | " << value(histogram.max()) << " |\n";
+  table << "| Outliers (> " << value(fence) << " " << unit << ") | "
+        << histogram.count_above(fence) << " |\n";
+
+  return table.str();
+}
+
+auto BenchmarkReporter::counters_json() const -> nlohmann::json {
+  const auto means = counter_means(_counters->samples);
+  nlohmann::json per_iteration = nlohmann::json::object();
+  for (size_t event = 0; event < PerfCounters::EVENT_COUNT; ++event) {
+    if (means[event]) {
+      per_iteration[std::string(PerfCounters::name(static_cast<PerfCounters::Event>(event)))] =
+          *means[event];
+    }
+  }
+  return {{"available", !per_iteration.empty()},
+          {"error", _counters->error},
+          {"iterations", _counters->samples.size()},
+          {"work_per_iteration", _counters->work_per_iteration},
+          {"work_unit", _counters->work_unit},
+          {"per_iteration", per_iteration}};
+}
+
+auto BenchmarkReporter::format_counter_table() -> std::string {
+  const auto means = counter_means(_counters->samples);
+  if (std::none_of(means.begin(), means.end(), [](const auto& mean) { return mean; })) {
+    const std::string& error = _counters->error;
+    return "Hardware counters unavailable" + (error.empty() ? "" : ": " + error) + ".\n";
+  }
+
+  const std::string unit = _counters->work_unit.empty() ? "unit" : _counters->work_unit;
+  const double work = std::max(_counters->work_per_iteration, 1e-12);
+  const auto& instructions = means[PerfCounters::INSTRUCTIONS];
+
+  std::stringstream table;
+  table << "Means over " << _counters->samples.size() << " iterations of " << work << " " << unit
+        << "s each.\n\n";
+  table << "| Counter | Per Iteration | Per " << unit << " | Per 1k Instructions |\n";
+  table << "|---------|---------------|-----|---------------------|\n";
+  table << std::fixed << std::setprecision(2);
+  for (size_t event = 0; event < PerfCounters::EVENT_COUNT; ++event) {
+    table << "| " << PerfCounters::name(static_cast<PerfCounters::Event>(event)) << " | ";
+    if (!means[event]) {
+      table << "n/a | n/a | n/a |\n";
+      continue;
+    }
+    table << *means[event] << " | " << *means[event] / work << " | ";
+    // Misses per thousand instructions; cycles and instructions are covered by IPC
+    if (event >= PerfCounters::L1D_MISSES && instructions && *instructions > 0.0) {
+      table << *means[event] * 1000.0 / *instructions << " |\n";
+    } else {
+      table << "- |\n";
+    }
+  }
+  const auto& cycles = means[PerfCounters::CYCLES];
+  if (cycles && instructions && *cycles > 0.0) {
+    table << "\nInstructions per cycle: " << *instructions / *cycles << "\n";
+  }
+
+  return table.str();
+}
+
+auto BenchmarkReporter::allocations_json() const -> nlohmann::json {
+  const double iterations = static_cast<double>(std::max<uint64_t>(_allocations->iterations, 1));
+  nlohmann::json phases = nlohmann::json::object();
+  for (const AllocationReport::Phase& phase : _allocations->phases) {
+    phases[phase.name] = {
+        {"allocations", phase.total.allocations},
+        {"bytes", phase.total.bytes},
+        {"allocations_per_iteration", static_cast<double>(phase.total.allocations) / iterations},
+        {"bytes_per_iteration", static_cast<double>(phase.total.bytes) / iterations}};
+  }
+  return {{"iterations", _allocations->iterations},
+          {"iteration_unit", _allocations->iteration_unit},
+          {"phases", phases}};
+}
+
+auto BenchmarkReporter::format_allocation_table() -> std::string {
+  const std::string& unit = _allocations->iteration_unit;
+  const double iterations = static_cast<double>(std::max<uint64_t>(_allocations->iterations, 1));
+
+  std::stringstream table;
+  table << "Totals over " << _allocations->iterations << " " << unit << "s.\n\n";
+  table << "| Phase | Allocations | Bytes | Allocations per " << unit << " | Bytes per " << unit
+        << " |\n";
+  table << "|-------|-------------|-------|-----------------|-----------|\n";
+  table << std::fixed << std::setprecision(2);
+  for (const AllocationReport::Phase& phase : _allocations->phases) {
+    table << "| " << phase.name << " | " << phase.total.allocations << " | " << phase.total.bytes
+          << " | " << static_cast<double>(phase.total.allocations) / iterations << " | "
+          << static_cast<double>(phase.total.bytes) / iterations << " |\n";
+  }
+
+  return table.str();
+}
+
+auto BenchmarkReporter::memory_json() const -> nlohmann::json {
+  nlohmann::json parts = nlohmann::json::object();
+  for (const MemoryReport::Part& part : _memory->parts) {
+    nlohmann::json json = {{"bytes", part.usage.bytes}, {"allocations", part.usage.allocations}};
+    if (part.count > 0) {
+      const double count = static_cast<double>(part.count);
+      json["count"] = part.count;
+      json["unit"] = part.unit;
+      json["bytes_per_object"] = static_cast<double>(part.usage.bytes) / count;
+      json["allocations_per_object"] = static_cast<double>(part.usage.allocations) / count;
+    }
+    parts[part.name] = json;
+  }
+  return {{"parts", parts}};
+}
+
+auto BenchmarkReporter::format_memory_table() -> std::string {
+  std::stringstream table;
+  table << "Heap held by the benchmarked state, including reserved but unused capacity.\n\n";
+  table << "| Part | Bytes | Allocations | Objects | Bytes per Object | Allocations per Object |\n";
+  table << "|------|-------|-------------|---------|------------------|------------------------|\n";
+  table << std::fixed << std::setprecision(1);
+  for (const MemoryReport::Part& part : _memory->parts) {
+    table << "| " << part.name << " | " << part.usage.bytes << " | " << part.usage.allocations;
+    if (part.count == 0) {
+      table << " | | | |\n";
+      continue;
+    }
+    const double count = static_cast<double>(part.count);
+    table << " | " << part.count << " (" << part.unit << ") | "
+          << static_cast<double>(part.usage.bytes) / count << " | "
+          << static_cast<double>(part.usage.allocations) / count << " |\n";
+  }
 
   return table.str();
 }
@@ -91,12 +613,43 @@ auto BenchmarkReporter::format_raw_data_table() -> std::string {
   std::string unit = determine_best_unit();
 
   std::stringstream table;
-  table << "| Run | Duration (" << unit << ") |\n";
-  table << "|-----|---------------|\n";
+  table << "| Run | Duration (" << unit << ") | Note |\n";
+  table << "|-----|---------------|------|\n";
 
+  auto contains = [](const std::vector<size_t>& indices, size_t index) {
+    return std::find(indices.begin(), indices.end(), index) != indices.end();
+  };
   for (size_t i = 0; i < _raw_data.size(); ++i) {
+    const char* note = contains(_severe_outliers, i) ? "severe outlier"
+                       : contains(_mild_outliers, i) ? "mild outlier"
+                                                     : "";
     table << "| " << (i + 1) << " | " << std::fixed << std::setprecision(2)
-          << convert_to_best_unit(_raw_data[i]) << " |\n";
+          << convert_to_best_unit(_raw_data[i]) << " | " << note << " |\n";
+  }
+
+  return table.str();
+}
+
+auto BenchmarkReporter::format_scaling_table() -> std::string {
+  std::string unit = determine_best_unit();
+  const ScalingRun& baseline = _scaling_runs.front();
+  const double baseline_mean = StatisticalBenchmarkRunner::calculate_mean(baseline.data);
+
+  std::stringstream table;
+  table << "| Threads | Mean (" << unit << ") | Std Dev (" << unit
+        << ") | Speedup | Efficiency |\n";
+  table << "|---------|------|---------|---------|------------|\n";
+
+  for (const ScalingRun& run : _scaling_runs) {
+    const double mean = StatisticalBenchmarkRunner::calculate_mean(run.data);
+    const double std_dev = StatisticalBenchmarkRunner::calculate_std_dev(run.data, mean);
+    const double speedup = mean > 0.0 ? baseline_mean / mean : 0.0;
+    // Efficiency is speedup per added thread: 100% means perfectly linear scaling
+    const double efficiency =
+        speedup * static_cast<double>(baseline.threads) / static_cast<double>(run.threads);
+    table << "| " << run.threads << " | " << std::fixed << std::setprecision(2)
+          << convert_to_best_unit(mean) << " | " << convert_to_best_unit(std_dev) << " | "
+          << speedup << "x | " << std::setprecision(1) << efficiency * 100.0 << "% |\n";
   }
 
   return table.str();
@@ -149,6 +702,46 @@ auto StatisticalBenchmarkRunner::calculate_mean(const std::vector<double>& data)
   return sum / data.size();
 }
 
+auto StatisticalBenchmarkRunner::relative_ci(const std::vector<double>& data) -> double {
+  if (data.size() < 2)
+    return std::numeric_limits<double>::infinity();
+
+  const double mean = calculate_mean(data);
+  if (mean <= 0.0)
+    return std::numeric_limits<double>::infinity();
+  // Sample standard deviation, unlike calculate_std_dev which reports the population one
+  const auto n = static_cast<double>(data.size());
+  const double std_dev = calculate_std_dev(data, mean) * std::sqrt(n / (n - 1.0));
+  return 1.96 * std_dev / std::sqrt(n) / mean;
+}
+
+auto StatisticalBenchmarkRunner::calculate_percentile(std::vector<double> data, double percentile)
+    -> double {
+  if (data.empty())
+    return 0.0;
+
+  std::sort(data.begin(), data.end());
+  const double position =
+      std::clamp(percentile, 0.0, 100.0) / 100.0 * static_cast<double>(data.size() - 1);
+  const auto lower = static_cast<size_t>(std::floor(position));
+  const size_t upper = std::min(lower + 1, data.size() - 1);
+  return data[lower] + (data[upper] - data[lower]) * (position - static_cast<double>(lower));
+}
+
+auto StatisticalBenchmarkRunner::calculate_median(std::vector<double> data) -> double {
+  if (data.empty())
+    return 0.0;
+
+  const size_t middle = data.size() / 2;
+  std::nth_element(data.begin(), data.begin() + middle, data.end());
+  if (data.size() % 2 == 1) {
+    return data[middle];
+  }
+  const double upper = data[middle];
+  const double lower = *std::max_element(data.begin(), data.begin() + middle);
+  return (lower + upper) / 2.0;
+}
+
 auto StatisticalBenchmarkRunner::calculate_std_dev(const std::vector<double>& data, double mean)
     -> double {
   if (data.empty())
@@ -175,11 +768,100 @@ auto StatisticalBenchmarkRunner::get_max(const std::vector<double>& data) -> dou
   return *std::max_element(data.begin(), data.end());
 }
 
+auto StatisticalBenchmarkRunner::mann_whitney_p(const std::vector<double>& a,
+                                                const std::vector<double>& b) -> double {
+  if (a.empty() || b.empty())
+    return 1.0;
+
+  // Rank the pooled samples, giving tied values the mean of their ranks
+  std::vector<std::pair<double, bool>> pooled;
+  pooled.reserve(a.size() + b.size());
+  for (double value : a) {
+    pooled.emplace_back(value, true);
+  }
+  for (double value : b) {
+    pooled.emplace_back(value, false);
+  }
+  std::sort(pooled.begin(), pooled.end());
+
+  const auto n = static_cast<double>(pooled.size());
+  double rank_sum_a = 0.0;
+  double tie_term = 0.0;
+  for (size_t first = 0; first < pooled.size();) {
+    size_t last = first;
+    while (last < pooled.size() && pooled[last].first == pooled[first].first) {
+      ++last;
+    }
+    const double ties = static_cast<double>(last - first);
+    const double rank = (static_cast<double>(first + last) + 1.0) / 2.0;
+    for (size_t i = first; i < last; ++i) {
+      if (pooled[i].second) {
+        rank_sum_a += rank;
+      }
+    }
+    tie_term += ties * ties * ties - ties;
+    first = last;
+  }
+
+  const auto n_a = static_cast<double>(a.size());
+  const auto n_b = static_cast<double>(b.size());
+  const double u = rank_sum_a - n_a * (n_a + 1.0) / 2.0;
+  const double mean = n_a * n_b / 2.0;
+  const double variance = n_a * n_b / 12.0 * ((n + 1.0) - tie_term / (n * (n - 1.0)));
+  if (variance <= 0.0)
+    return 1.0;
+
+  // Continuity-corrected normal approximation, good from about 10 samples per side
+  const double z = std::max(0.0, std::abs(u - mean) - 0.5) / std::sqrt(variance);
+  return std::erfc(z / std::sqrt(2.0));
+}
+
+auto StatisticalBenchmarkRunner::bootstrap_median_ratio(const std::vector<double>& a,
+                                                        const std::vector<double>& b,
+                                                        double confidence, size_t resamples,
+                                                        uint64_t seed)
+    -> std::pair<double, double> {
+  if (a.empty() || b.empty() || resamples == 0)
+    return {0.0, 0.0};
+
+  RandomGenerator rng(seed);
+  auto resample = [&](const std::vector<double>& data, std::vector<double>& out) {
+    for (double& value : out) {
+      value = data[rng.uniform_int(0, static_cast<int>(data.size()) - 1)];
+    }
+    return calculate_median(out);
+  };
+
+  std::vector<double> sample_a(a.size());
+  std::vector<double> sample_b(b.size());
+  std::vector<double> ratios;
+  ratios.reserve(resamples);
+  for (size_t i = 0; i < resamples; ++i) {
+    const double median_a = resample(a, sample_a);
+    const double median_b = resample(b, sample_b);
+    if (median_a > 0.0) {
+      ratios.push_back(median_b / median_a);
+    }
+  }
+  if (ratios.empty())
+    return {0.0, 0.0};
+
+  std::sort(ratios.begin(), ratios.end());
+  const double tail = (1.0 - confidence) / 2.0;
+  const auto last = static_cast<double>(ratios.size() - 1);
+  return {ratios[static_cast<size_t>(std::floor(tail * last))],
+          ratios[static_cast<size_t>(std::ceil((1.0 - tail) * last))]};
+}
+
 // BenchmarkReporter smart unit selection methods
 auto BenchmarkReporter::determine_best_unit() -> std::string {
-  if (_mean >= 1000000.0) {  // >= 1 ms
+  return determine_unit(_mean);
+}
+
+auto BenchmarkReporter::determine_unit(double value_ns) -> std::string {
+  if (value_ns >= 1000000.0) {  // >= 1 ms
     return "ms";
-  } else if (_mean >= 1000.0) {  // >= 1 μs
+  } else if (value_ns >= 1000.0) {  // >= 1 μs
     return "μs";
   } else {
     return "ns";
@@ -187,8 +869,10 @@ auto BenchmarkReporter::determine_best_unit() -> std::string {
 }
 
 auto BenchmarkReporter::convert_to_best_unit(double value_ns) -> double {
-  std::string unit = determine_best_unit();
+  return convert_to_unit(value_ns, determine_best_unit());
+}
 
+auto BenchmarkReporter::convert_to_unit(double value_ns, const std::string& unit) -> double {
   if (unit == "ms") {
     return value_ns / 1000000.0;
   } else if (unit == "μs") {
@@ -0,0 +1,118 @@
+#include "tests/helpers/latency_histogram.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+LatencyHistogram::LatencyHistogram() : _counts(BUCKET_COUNT, 0) {}
+
+auto LatencyHistogram::bucket_index(uint64_t value) -> size_t {
+  if (value < SUB_BUCKETS) {
+    return static_cast<size_t>(value);
+  }
+  // The top SUB_BUCKET_BITS + 1 bits pick the bucket within the value's power of two
+  const auto shift = static_cast<uint32_t>(std::bit_width(value)) - 1 - SUB_BUCKET_BITS;
+  return static_cast<size_t>(SUB_BUCKETS * shift + (value >> shift));
+}
+
+auto LatencyHistogram::bucket_lower(size_t index) -> uint64_t {
+  if (index < SUB_BUCKETS) {
+    return index;
+  }
+  const uint64_t shift = index / SUB_BUCKETS - 1;
+  return (index - SUB_BUCKETS * shift) << shift;
+}
+
+auto LatencyHistogram::bucket_upper(size_t index) -> uint64_t {
+  if (index < SUB_BUCKETS) {
+    return index;
+  }
+  const uint64_t shift = index / SUB_BUCKETS - 1;
+  // Wraps to UINT64_MAX for the very last bucket
+  return ((index - SUB_BUCKETS * shift + 1) << shift) - 1;
+}
+
+auto LatencyHistogram::record(uint64_t value) -> void {
+  if (_discarded < _warmUp) {
+    ++_discarded;
+    return;
+  }
+  ++_counts[bucket_index(value)];
+  ++_count;
+  _min = std::min(_min, value);
+  _max = std::max(_max, value);
+  _sum += static_cast<double>(value);
+}
+
+auto LatencyHistogram::reset() -> void {
+  std::fill(_counts.begin(), _counts.end(), 0);
+  _count = 0;
+  _min = UINT64_MAX;
+  _max = 0;
+  _sum = 0.0;
+  _discarded = 0;
+}
+
+auto LatencyHistogram::merge(const LatencyHistogram& other) -> void {
+  for (size_t index = 0; index < BUCKET_COUNT; ++index) {
+    _counts[index] += other._counts[index];
+  }
+  _count += other._count;
+  _min = std::min(_min, other._min);
+  _max = std::max(_max, other._max);
+  _sum += other._sum;
+}
+
+auto LatencyHistogram::set_warm_up(size_t samples) -> void {
+  _warmUp = samples;
+}
+
+auto LatencyHistogram::get_warm_up() const -> size_t {
+  return _warmUp;
+}
+
+auto LatencyHistogram::get_discarded() const -> size_t {
+  return _discarded;
+}
+
+auto LatencyHistogram::count() const -> uint64_t {
+  return _count;
+}
+
+auto LatencyHistogram::min() const -> uint64_t {
+  return _count == 0 ? 0 : _min;
+}
+
+auto LatencyHistogram::max() const -> uint64_t {
+  return _max;
+}
+
+auto LatencyHistogram::mean() const -> double {
+  return _count == 0 ? 0.0 : _sum / static_cast<double>(_count);
+}
+
+auto LatencyHistogram::percentile(double percentile) const -> uint64_t {
+  if (_count == 0) {
+    return 0;
+  }
+  const double fraction = std::clamp(percentile, 0.0, 100.0) / 100.0;
+  const auto rank = std::max<uint64_t>(
+      1, static_cast<uint64_t>(std::ceil(fraction * static_cast<double>(_count))));
+
+  uint64_t seen = 0;
+  for (size_t index = 0; index < BUCKET_COUNT; ++index) {
+    seen += _counts[index];
+    if (seen >= rank) {
+      return std::clamp(bucket_upper(index), min(), _max);
+    }
+  }
+  return _max;
+}
+
+auto LatencyHistogram::count_above(uint64_t value) const -> uint64_t {
+  uint64_t above = 0;
+  for (size_t index = bucket_index(value) + 1; index < BUCKET_COUNT; ++index) {
+    above += _counts[index];
+  }
+  return above;
+}
@@ -0,0 +1,195 @@
+#include "tests/helpers/perf_counters.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cerrno>
+#endif
+
+auto PerfCounters::Sample::operator+=(const Sample& other) -> Sample& {
+  if (empty()) {
+    *this = other;
+    return *this;
+  }
+  for (size_t event = 0; event < EVENT_COUNT; ++event) {
+    valid[event] = valid[event] && other.valid[event];
+    values[event] += other.values[event];
+  }
+  return *this;
+}
+
+auto PerfCounters::Sample::empty() const -> bool {
+  for (const bool counted : valid) {
+    if (counted) {
+      return false;
+    }
+  }
+  return true;
+}
+
+auto PerfCounters::name(Event event) -> std::string_view {
+  switch (event) {
+    case CYCLES:
+      return "cycles";
+    case INSTRUCTIONS:
+      return "instructions";
+    case L1D_MISSES:
+      return "L1D read misses";
+    case LLC_MISSES:
+      return "LLC read misses";
+    case BRANCH_MISSES:
+      return "branch misses";
+    case DTLB_MISSES:
+      return "dTLB read misses";
+    default:
+      return "unknown";
+  }
+}
+
+auto PerfCounters::requested() -> bool {
+  const char* value = std::getenv("BENCHMARK_PERF_COUNTERS");
+  return value != nullptr && *value != '\0' && std::strcmp(value, "0") != 0;
+}
+
+#if defined(__linux__)
+namespace {
+auto event_attr(PerfCounters::Event event) -> perf_event_attr {
+  perf_event_attr attr{};
+  attr.size = sizeof(attr);
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  attr.read_format =
+      PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+  auto cache_read_miss = [](uint64_t cache) {
+    return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+  };
+  switch (event) {
+    case PerfCounters::CYCLES:
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.config = PERF_COUNT_HW_CPU_CYCLES;
+      break;
+    case PerfCounters::INSTRUCTIONS:
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+      break;
+    case PerfCounters::L1D_MISSES:
+      attr.type = PERF_TYPE_HW_CACHE;
+      attr.config = cache_read_miss(PERF_COUNT_HW_CACHE_L1D);
+      break;
+    case PerfCounters::LLC_MISSES:
+      attr.type = PERF_TYPE_HW_CACHE;
+      attr.config = cache_read_miss(PERF_COUNT_HW_CACHE_LL);
+      break;
+    case PerfCounters::BRANCH_MISSES:
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+      break;
+    default:
+      attr.type = PERF_TYPE_HW_CACHE;
+      attr.config = cache_read_miss(PERF_COUNT_HW_CACHE_DTLB);
+      break;
+  }
+  return attr;
+}
+}  // namespace
+
+PerfCounters::PerfCounters() {
+  for (size_t event = 0; event < EVENT_COUNT; ++event) {
+    if (_groups.empty() || _groups.back().events.size() == GROUP_SIZE) {
+      _groups.emplace_back();
+    }
+    open_event(static_cast<Event>(event), _groups.back());
+  }
+  std::erase_if(_groups, [](const Group& group) { return group.leader < 0; });
+  if (!_groups.empty()) {
+    _error.clear();
+  }
+}
+
+PerfCounters::~PerfCounters() {
+  for (const int fd : _fds) {
+    close(fd);
+  }
+}
+
+auto PerfCounters::open_event(Event event, Group& group) -> bool {
+  perf_event_attr attr = event_attr(event);
+  // Only the leader starts disabled; members follow it
+  attr.disabled = group.leader < 0 ? 1 : 0;
+  const auto fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, group.leader, 0));
+  if (fd < 0) {
+    if (_error.empty()) {
+      _error = "perf_event_open failed for " + std::string(name(event)) + ": " +
+               std::strerror(errno);
+    }
+    return false;
+  }
+  if (group.leader < 0) {
+    group.leader = fd;
+  }
+  group.events.push_back(event);
+  _fds.push_back(fd);
+  return true;
+}
+
+auto PerfCounters::start() -> void {
+  for (const Group& group : _groups) {
+    ioctl(group.leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(group.leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+  }
+}
+
+auto PerfCounters::stop() -> Sample {
+  for (const Group& group : _groups) {
+    ioctl(group.leader, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+  }
+
+  Sample sample;
+  for (const Group& group : _groups) {
+    // nr, time enabled, time running, then one value per member
+    std::array<uint64_t, 3 + GROUP_SIZE> buffer{};
+    const ssize_t bytes = read(group.leader, buffer.data(), sizeof(buffer));
+    if (bytes < static_cast<ssize_t>(3 * sizeof(uint64_t)) || buffer[2] == 0) {
+      continue;  // unreadable, or the group never got onto the PMU
+    }
+    const double scale = static_cast<double>(buffer[1]) / static_cast<double>(buffer[2]);
+    const size_t members = std::min<size_t>(buffer[0], group.events.size());
+    for (size_t member = 0; member < members; ++member) {
+      const Event event = group.events[member];
+      sample.values[event] = static_cast<uint64_t>(static_cast<double>(buffer[3 + member]) * scale);
+      sample.valid[event] = true;
+    }
+  }
+  return sample;
+}
+#else
+PerfCounters::PerfCounters() : _error("hardware counters need Linux perf_event_open") {}
+
+PerfCounters::~PerfCounters() = default;
+
+auto PerfCounters::open_event(Event, Group&) -> bool {
+  return false;
+}
+
+auto PerfCounters::start() -> void {}
+
+auto PerfCounters::stop() -> Sample {
+  return {};
+}
+#endif
+
+auto PerfCounters::is_available() const -> bool {
+  return !_groups.empty();
+}
+
+auto PerfCounters::get_error() const -> const std::string& {
+  return _error;
+}
@@ -124,22 +124,24 @@ auto TextureCache::get_texture(size_t index) -> Texture2D& {
 }
 
 auto TextureCache::get_random_texture_index(const std::string& prefix) const -> size_t {
-  std::vector<size_t> matching_indices;
-
+  // Counted and then walked again rather than collected, so respawning allocates nothing
+  auto matches = [&](size_t i) { return _textures.key_at(i).starts_with(prefix); };
+  int matching = 0;
   for (size_t i = 0; i < _textures.size(); ++i) {
-    if (_textures.key_at(i).starts_with(prefix)) {
-      matching_indices.push_back(i);
-    }
+    matching += matches(i) ? 1 : 0;
   }
 
-  if (matching_indices.empty()) {
+  if (matching == 0) {
     throw std::runtime_error("No textures found with prefix: " + prefix);
   }
 
   static RandomGenerator rng;
-  int random_index = rng.uniform_int(0, static_cast<int>(matching_indices.size()) - 1);
-
-  return matching_indices[random_index];
+  int remaining = rng.uniform_int(0, matching - 1);
+  for (size_t i = 0;; ++i) {
+    if (matches(i) && remaining-- == 0) {
+      return i;
+    }
+  }
 }
 
 TextureCache::~TextureCache() {
@@ -1,7 +1,11 @@
 #include <fmt/format.h>
 #include <imgui.h>
+#include <implot.h>
 #include <raylib.h>
 
+#include <algorithm>
+#include <cmath>
+
 #include <ui/menu/fitness_display.hpp>
 
 #include "game.hpp"
@@ -43,3 +47,68 @@ auto UI::Menu::FitnessDisplay::set_mean(double mean) -> void {
 auto UI::Menu::FitnessDisplay::get_mean() -> double {
   return _mean;
 }
+
+auto UI::Menu::FitnessDisplay::draw_history(const Population& population) -> void {
+  ImGui::SetNextWindowPos(ImVec2{20.0f, 80.0f}, ImGuiCond_FirstUseEver);
+  ImGui::SetNextWindowSize(ImVec2{520.0f, 700.0f}, ImGuiCond_FirstUseEver);
+  if (ImGui::Begin("History")) {
+    ImGui::Checkbox("Follow", &_follow);
+
+    const ImVec2 size{-1.0f, 150.0f};
+    const auto follow = [&](Population::HistorySeries series) {
+      if (_follow) {
+        const double samples = static_cast<double>(population.get_history(series).size());
+        ImPlot::SetupAxisLimits(ImAxis_X1, 0.0, std::max(samples, 1.0), ImPlotCond_Always);
+      }
+    };
+
+    ImPlot::PushStyleVar(ImPlotStyleVar_FillAlpha, 0.25f);
+    if (ImPlot::BeginPlot("Fitness", size)) {
+      ImPlot::SetupAxes("tick", "fitness", 0, ImPlotAxisFlags_AutoFit);
+      follow(Population::MEAN_FITNESS);
+      plot_series("mean of recent genomes", population.get_history(Population::MEAN_FITNESS));
+      plot_series("top", population.get_history(Population::TOP_FITNESS));
+      ImPlot::EndPlot();
+    }
+    if (ImPlot::BeginPlot("Retired genomes", size)) {
+      ImPlot::SetupAxes("genome", "fitness", 0, ImPlotAxisFlags_AutoFit);
+      follow(Population::GENOME_FITNESS);
+      plot_series("fitness", population.get_history(Population::GENOME_FITNESS));
+      ImPlot::EndPlot();
+    }
+    if (ImPlot::BeginPlot("Pangenome", size)) {
+      ImPlot::SetupAxes("tick", "genomes", 0, ImPlotAxisFlags_AutoFit);
+      follow(Population::PANGENOME_SIZE);
+      plot_series("size", population.get_history(Population::PANGENOME_SIZE));
+      ImPlot::EndPlot();
+    }
+    if (ImPlot::BeginPlot("Births and deaths", size)) {
+      ImPlot::SetupAxes("tick", "ants", 0, ImPlotAxisFlags_AutoFit);
+      follow(Population::BIRTHS);
+      plot_series("births", population.get_history(Population::BIRTHS));
+      plot_series("deaths", population.get_history(Population::DEATHS));
+      ImPlot::EndPlot();
+    }
+    ImPlot::PopStyleVar();
+  }
+  ImGui::End();
+}
+
+auto UI::Menu::FitnessDisplay::plot_series(const char* label,
+                                           const Population::History& history) -> void {
+  const ImPlotRect limits = ImPlot::GetPlotLimits();
+  const uint64_t first = static_cast<uint64_t>(std::max(0.0, std::floor(limits.X.Min)));
+  const uint64_t last = static_cast<uint64_t>(std::max(0.0, std::ceil(limits.X.Max))) + 1;
+  const size_t pixels = static_cast<size_t>(std::max(1.0f, ImPlot::GetPlotSize().x));
+  history.sample(first, last, pixels, _points);
+  if (_points.empty()) {
+    return;
+  }
+
+  // Each bucket's min-max envelope as a band under its mean; both share the label and colour
+  const auto& start = _points.front();
+  const int count = static_cast<int>(_points.size());
+  const int stride = static_cast<int>(sizeof(Population::History::Point));
+  ImPlot::PlotShaded(label, &start.first, &start.min, &start.max, count, 0, 0, stride);
+  ImPlot::PlotLine(label, &start.first, &start.mean, count, 0, 0, stride);
+}
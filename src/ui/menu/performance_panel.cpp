@@ -0,0 +1,179 @@
+#include <imgui.h>
+#include <implot.h>
+
+#include <algorithm>
+#include <ui/menu/performance_panel.hpp>
+
+#include "ui/state.hpp"
+#include "util/allocation_counter.hpp"
+
+namespace {
+auto mebibytes(size_t bytes) -> double {
+  return static_cast<double>(bytes) / (1024.0 * 1024.0);
+}
+}  // namespace
+
+UI::Menu::PerformancePanel::PerformancePanel(UI::State& state) : _state(state) {
+  for (auto& series : _series) {
+    series.assign(HISTORY, 0.0F);
+  }
+}
+
+auto UI::Menu::PerformancePanel::publish(const Frame& frame) -> bool {
+  return _feed.push(frame);
+}
+
+auto UI::Menu::PerformancePanel::update() -> void {
+  _feed.drain([&](const Frame& frame) { record(frame); });
+}
+
+auto UI::Menu::PerformancePanel::record(const Frame& frame) -> void {
+  auto set = [&](size_t series, double value) {
+    _series[series][_next] = static_cast<float>(value);
+  };
+  const double perSecond = frame.seconds > 0.0 ? 1.0 / frame.seconds : 0.0;
+  const double accounted = frame.simulationSeconds + frame.renderSeconds + frame.uiSeconds;
+
+  set(FRAME_MS, frame.seconds * 1000.0);
+  set(SIMULATION_MS, frame.simulationSeconds * 1000.0);
+  set(RENDER_MS, frame.renderSeconds * 1000.0);
+  set(UI_MS, frame.uiSeconds * 1000.0);
+  set(PRESENT_MS, std::max(0.0, frame.seconds - accounted) * 1000.0);
+  set(ANTS_PER_SECOND, static_cast<double>(frame.antsUpdated) * perSecond);
+  set(FORWARD_PASSES_PER_SECOND, static_cast<double>(frame.forwardPasses) * perSecond);
+  set(ALLOCATIONS, static_cast<double>(frame.allocations));
+  set(POOL_PERCENT, frame.poolUtilization * 100.0);
+  if (frame.hasMemory) {
+    _memory = frame.memory;
+  }
+  set(HEAP_MIB, _memory ? mebibytes(_memory->total.bytes) : 0.0);
+  for (size_t phase = 0; phase < Util::TickProfile::PHASE_COUNT; ++phase) {
+    set(PHASE_MS + phase, frame.phaseSeconds[phase] * 1000.0);
+  }
+
+  _next = (_next + 1) % HISTORY;
+  _count = std::min(_count + 1, HISTORY);
+  ++_frames;
+  _ticks += frame.ticks;
+}
+
+auto UI::Menu::PerformancePanel::latest(size_t series) const -> float {
+  return _count == 0 ? 0.0F : _series[series][(_next + HISTORY - 1) % HISTORY];
+}
+
+auto UI::Menu::PerformancePanel::plot_line(const char* label, size_t series) const -> void {
+  // Before the history fills up the oldest value is at index 0
+  const int offset = _count == HISTORY ? static_cast<int>(_next) : 0;
+  const double firstFrame = static_cast<double>(_frames - _count);
+  ImPlot::PlotLine(label, _series[series].data(), static_cast<int>(_count), 1.0, firstFrame, 0,
+                   offset);
+}
+
+auto UI::Menu::PerformancePanel::draw_memory() const -> void {
+  const World::MemoryReport& memory = *_memory;
+  ImGui::Text("Heap %.1f MiB in %zu allocations", mebibytes(memory.total.bytes),
+              memory.total.allocations);
+  if (!ImGui::BeginTable("##memory", 5, ImGuiTableFlags_RowBg)) {
+    return;
+  }
+  ImGui::TableSetupColumn("part");
+  ImGui::TableSetupColumn("MiB");
+  ImGui::TableSetupColumn("objects");
+  ImGui::TableSetupColumn("bytes each");
+  ImGui::TableSetupColumn("allocations each");
+  ImGui::TableHeadersRow();
+  auto row = [](const char* name, const Util::MemoryUsage& usage, size_t count) {
+    const double objects = static_cast<double>(std::max<size_t>(count, 1));
+    ImGui::TableNextRow();
+    ImGui::TableNextColumn();
+    ImGui::Text("%s", name);
+    ImGui::TableNextColumn();
+    ImGui::Text("%.2f", mebibytes(usage.bytes));
+    ImGui::TableNextColumn();
+    ImGui::Text("%zu", count);
+    ImGui::TableNextColumn();
+    ImGui::Text("%.0f", static_cast<double>(usage.bytes) / objects);
+    ImGui::TableNextColumn();
+    ImGui::Text("%.1f", static_cast<double>(usage.allocations) / objects);
+  };
+  row("ants", memory.ants, memory.antCount);
+  row("pangenome", memory.pangenome, memory.genomeCount);
+  row("food", memory.resources, memory.foodCount);
+  row("history", memory.history, Population::HISTORY_SERIES_COUNT);
+  ImGui::EndTable();
+}
+
+auto UI::Menu::PerformancePanel::draw() -> void {
+  if (!_state.is_maximized(State::PERFORMANCE)) {
+    return;
+  }
+
+  ImGui::SetNextWindowPos(ImVec2{10.0f, 60.0f}, ImGuiCond_FirstUseEver);
+  ImGui::SetNextWindowSize(ImVec2{460.0f, 960.0f}, ImGuiCond_FirstUseEver);
+  bool open = true;
+  if (ImGui::Begin("Performance (F3)", &open)) {
+    const float frameMs = latest(FRAME_MS);
+    ImGui::Text("%.1f FPS, %.2f ms/frame, %llu ticks", frameMs > 0.0F ? 1000.0F / frameMs : 0.0F,
+                frameMs, static_cast<unsigned long long>(_ticks));
+    ImGui::Text("%.0f ants/s, %.0f forward passes/s", latest(ANTS_PER_SECOND),
+                latest(FORWARD_PASSES_PER_SECOND));
+    // Allocations are only counted in builds that link the counting operator new, which the
+    // game does when configured with -DNEURAL_ANTS_COUNT_ALLOCATIONS=ON
+    const bool allocations = Util::AllocationCounter::is_enabled();
+    if (allocations) {
+      ImGui::Text("%.0f allocations/frame", latest(ALLOCATIONS));
+    } else {
+      ImGui::TextDisabled("allocations not counted: build with NEURAL_ANTS_COUNT_ALLOCATIONS=ON");
+    }
+    ImGui::Text("thread pool %.0f%% busy, %llu frames dropped", latest(POOL_PERCENT),
+                static_cast<unsigned long long>(_feed.get_dropped()));
+    if (_memory) {
+      draw_memory();
+    }
+
+    const ImVec2 plotSize{-1.0f, 140.0f};
+    const ImPlotAxisFlags fit = ImPlotAxisFlags_AutoFit;
+    if (ImPlot::BeginPlot("Frame time", plotSize)) {
+      ImPlot::SetupAxes("frame", "ms", fit, fit);
+      plot_line("frame", FRAME_MS);
+      plot_line("simulation", SIMULATION_MS);
+      plot_line("render", RENDER_MS);
+      plot_line("ui", UI_MS);
+      plot_line("present", PRESENT_MS);
+      ImPlot::EndPlot();
+    }
+    if (ImPlot::BeginPlot("Simulation phases", plotSize)) {
+      ImPlot::SetupAxes("frame", "ms", fit, fit);
+      for (size_t phase = 0; phase < Util::TickProfile::PHASE_COUNT; ++phase) {
+        const auto name = Util::TickProfile::name(static_cast<Util::TickProfile::Phase>(phase));
+        plot_line(name.data(), PHASE_MS + phase);
+      }
+      ImPlot::EndPlot();
+    }
+    if (ImPlot::BeginPlot("Throughput", plotSize)) {
+      ImPlot::SetupAxes("frame", "per second", fit, fit);
+      plot_line("ants updated", ANTS_PER_SECOND);
+      plot_line("forward passes", FORWARD_PASSES_PER_SECOND);
+      ImPlot::EndPlot();
+    }
+    if (ImPlot::BeginPlot(allocations ? "Allocations and thread pool" : "Thread pool",
+                          plotSize)) {
+      ImPlot::SetupAxes("frame", nullptr, fit, fit);
+      if (allocations) {
+        plot_line("allocations/frame", ALLOCATIONS);
+      }
+      plot_line("pool busy %", POOL_PERCENT);
+      ImPlot::EndPlot();
+    }
+    if (ImPlot::BeginPlot("Heap", plotSize)) {
+      ImPlot::SetupAxes("frame", "MiB", fit, fit);
+      plot_line("world", HEAP_MIB);
+      ImPlot::EndPlot();
+    }
+  }
+  ImGui::End();
+
+  if (!open) {
+    _state.minimize(State::PERFORMANCE);
+  }
+}
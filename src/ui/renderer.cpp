@@ -1,4 +1,5 @@
 #include <imgui.h>
+#include <implot.h>
 #include <raylib.h>
 #include <rlImGui.h>
 
@@ -19,13 +20,21 @@ UI::Renderer::Renderer(Game& game, TextureCache& textureCache)
       _settingsMenu(_state, game, textureCache),
       _saveLoadMenu(_state, game, textureCache),
       _fitnessDisplay(),
+      _performancePanel(_state),
       _textureCache(textureCache) {}
 
+UI::Renderer::~Renderer() {
+  if (_setup) {
+    ImPlot::DestroyContext();
+  }
+}
+
 auto UI::Renderer::setup() -> void {
   if (_setup) {
     return;
   }
   rlImGuiSetup(false);
+  ImPlot::CreateContext();
   _setup = true;
 
   ImGuiStyle& style = ImGui::GetStyle();
@@ -82,7 +91,13 @@ auto UI::Renderer::draw(float deltaTime) -> void {
   _screenWidth = GetScreenWidth();
   
   draw_speed_display();
-  
+
+  if (IsKeyPressed(KEY_F3)) {
+    _state.toggle(State::PERFORMANCE);
+  }
+  // Drained even while hidden so the feed never fills up and the plots are current when shown
+  _performancePanel.update();
+
   rlImGuiBegin();
   if (_state.is_maximized(State::SETTINGS)) {
     _paused = false;
@@ -97,7 +112,9 @@ auto UI::Renderer::draw(float deltaTime) -> void {
   if (_state.is_maximized(State::MEAN_FITNESS)) {
     _fitnessDisplay.set_mean(_game.get_world().get_population().get_fitness_data().get_mean());
     _fitnessDisplay.draw();
+    _fitnessDisplay.draw_history(_game.get_world().get_population());
   }
+  _performancePanel.draw();
   rlImGuiEnd();
 }
 
@@ -135,6 +152,10 @@ auto UI::Renderer::unpause() -> void {
   _paused = false;
 }
 
+auto UI::Renderer::get_performance_panel() -> UI::Menu::PerformancePanel& {
+  return _performancePanel;
+}
+
 auto UI::Renderer::draw_speed_display() -> void {
   static long long lastUpdateSpeed = 1LL;
   static float displayTimer = 0.0f;
@@ -0,0 +1,26 @@
+#include "util/allocation_counter.hpp"
+
+#include <atomic>
+
+namespace {
+std::atomic<uint64_t> allocations{0};
+std::atomic<uint64_t> bytes{0};
+std::atomic<bool> enabled{false};
+}  // namespace
+
+auto Util::AllocationCounter::get() -> Counts {
+  return {allocations.load(std::memory_order_relaxed), bytes.load(std::memory_order_relaxed)};
+}
+
+auto Util::AllocationCounter::is_enabled() -> bool {
+  return enabled.load(std::memory_order_relaxed);
+}
+
+auto Util::AllocationCounter::record(std::size_t size) -> void {
+  allocations.fetch_add(1, std::memory_order_relaxed);
+  bytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+auto Util::AllocationCounter::enable() -> void {
+  enabled.store(true, std::memory_order_relaxed);
+}
@@ -0,0 +1,157 @@
+#include "util/half.hpp"
+
+#if defined(__F16C__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include <bit>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+namespace Util {
+
+namespace {
+// Rounds bits >> shift to nearest, ties to even
+auto round_shift(uint32_t bits, uint32_t shift) -> uint32_t {
+  const uint32_t kept = bits >> shift;
+  const uint32_t remainder = bits & ((1U << shift) - 1U);
+  const uint32_t halfway = 1U << (shift - 1U);
+  return kept + ((remainder > halfway || (remainder == halfway && (kept & 1U))) ? 1U : 0U);
+}
+
+auto check_sizes(size_t values, size_t out) -> void {
+  if (values != out) {
+    throw std::invalid_argument("Weight conversion size mismatch - " + std::to_string(values) +
+                                " values for " + std::to_string(out) + " outputs");
+  }
+}
+}  // namespace
+
+auto float_to_fp16(float value) -> Half {
+#if defined(__F16C__)
+  return static_cast<Half>(_cvtss_sh(value, _MM_FROUND_TO_NEAREST_INT));
+#else
+  const uint32_t bits = std::bit_cast<uint32_t>(value);
+  const uint32_t sign = (bits >> 16) & 0x8000U;
+  const uint32_t exponent = (bits >> 23) & 0xFFU;
+  uint32_t mantissa = bits & 0x7FFFFFU;
+
+  if (exponent == 0xFFU) {
+    return static_cast<Half>(sign | 0x7C00U | (mantissa != 0 ? 0x200U | (mantissa >> 13) : 0U));
+  }
+  const int32_t halfExponent = static_cast<int32_t>(exponent) - 127 + 15;
+  if (halfExponent >= 31) {
+    return static_cast<Half>(sign | 0x7C00U);
+  }
+  if (halfExponent <= 0) {
+    if (halfExponent < -10) {
+      return static_cast<Half>(sign);
+    }
+    // Subnormal; a carry out of the mantissa correctly produces the smallest normal
+    mantissa |= 0x800000U;
+    const auto shift = static_cast<uint32_t>(14 - halfExponent);
+    return static_cast<Half>(sign | round_shift(mantissa, shift));
+  }
+  // A carry out of the mantissa bumps the exponent, and past the largest finite value gives inf
+  const uint32_t half = (static_cast<uint32_t>(halfExponent) << 23) | mantissa;
+  return static_cast<Half>(sign | round_shift(half, 13));
+#endif
+}
+
+auto fp16_to_float(Half value) -> float {
+#if defined(__F16C__)
+  return _cvtsh_ss(value);
+#else
+  const uint32_t sign = static_cast<uint32_t>(value & 0x8000U) << 16;
+  const uint32_t exponent = (value >> 10) & 0x1FU;
+  const uint32_t mantissa = value & 0x3FFU;
+
+  if (exponent == 0) {
+    const float magnitude = std::ldexp(static_cast<float>(mantissa), -24);
+    return sign != 0 ? -magnitude : magnitude;
+  }
+  if (exponent == 0x1FU) {
+    const uint32_t quiet = mantissa != 0 ? 0x400000U : 0U;  // NaNs come out quiet, as with F16C
+    return std::bit_cast<float>(sign | 0x7F800000U | quiet | (mantissa << 13));
+  }
+  return std::bit_cast<float>(sign | ((exponent + 112U) << 23) | (mantissa << 13));
+#endif
+}
+
+auto float_to_bf16(float value) -> Half {
+  const uint32_t bits = std::bit_cast<uint32_t>(value);
+  if (std::isnan(value)) {
+    return static_cast<Half>((bits >> 16) | 0x40U);  // keep it a quiet NaN after truncation
+  }
+  return static_cast<Half>(round_shift(bits, 16));
+}
+
+auto bf16_to_float(Half value) -> float {
+  return std::bit_cast<float>(static_cast<uint32_t>(value) << 16);
+}
+
+auto narrow(std::span<const float> values, std::span<Half> out, WeightFormat format) -> void {
+  check_sizes(values.size(), out.size());
+  size_t index = 0;
+  switch (format) {
+    case FP16:
+#if defined(__F16C__)
+      for (; index + 8 <= values.size(); index += 8) {
+        const __m256 v = _mm256_loadu_ps(values.data() + index);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out.data() + index),
+                         _mm256_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT));
+      }
+#endif
+      for (; index < values.size(); ++index) {
+        out[index] = float_to_fp16(values[index]);
+      }
+      return;
+    case BF16:
+      // Narrowing only happens when a genome is stored, so the scalar rounding is fine here
+      for (; index < values.size(); ++index) {
+        out[index] = float_to_bf16(values[index]);
+      }
+      return;
+    default:
+      throw std::invalid_argument("Weights can only be narrowed to FP16 or BF16");
+  }
+}
+
+auto widen(std::span<const Half> values, std::span<float> out, WeightFormat format) -> void {
+  check_sizes(values.size(), out.size());
+  size_t index = 0;
+  switch (format) {
+    case FP16:
+#if defined(__F16C__)
+      for (; index + 8 <= values.size(); index += 8) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values.data() + index));
+        _mm256_storeu_ps(out.data() + index, _mm256_cvtph_ps(v));
+      }
+#endif
+      for (; index < values.size(); ++index) {
+        out[index] = fp16_to_float(values[index]);
+      }
+      return;
+    case BF16:
+#if defined(__AVX2__)
+      for (; index + 8 <= values.size(); index += 8) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values.data() + index));
+        const __m256i bits = _mm256_slli_epi32(_mm256_cvtepu16_epi32(v), 16);
+        _mm256_storeu_ps(out.data() + index, _mm256_castsi256_ps(bits));
+      }
+#endif
+      for (; index < values.size(); ++index) {
+        out[index] = bf16_to_float(values[index]);
+      }
+      return;
+    default:
+      throw std::invalid_argument("Weights can only be widened from FP16 or BF16");
+  }
+}
+
+auto weight_size(WeightFormat format) -> size_t {
+  return format == FP32 ? sizeof(float) : sizeof(Half);
+}
+
+}  // namespace Util
@@ -0,0 +1,36 @@
+#include "util/thread_pool_monitor.hpp"
+
+#include <tbb/task_arena.h>
+
+#include <chrono>
+
+namespace {
+typedef std::chrono::steady_clock Clock;
+
+thread_local Clock::time_point entered;
+}  // namespace
+
+Util::ThreadPoolMonitor::ThreadPoolMonitor() {
+  observe(true);
+}
+
+Util::ThreadPoolMonitor::~ThreadPoolMonitor() {
+  observe(false);
+}
+
+auto Util::ThreadPoolMonitor::get_busy_seconds() const -> double {
+  return static_cast<double>(_busyNanoseconds.load(std::memory_order_relaxed)) / 1e9;
+}
+
+auto Util::ThreadPoolMonitor::get_concurrency() -> size_t {
+  return static_cast<size_t>(tbb::this_task_arena::max_concurrency());
+}
+
+auto Util::ThreadPoolMonitor::on_scheduler_entry(bool) -> void {
+  entered = Clock::now();
+}
+
+auto Util::ThreadPoolMonitor::on_scheduler_exit(bool) -> void {
+  const auto busy = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - entered);
+  _busyNanoseconds.fetch_add(static_cast<uint64_t>(busy.count()), std::memory_order_relaxed);
+}
@@ -1,5 +1,8 @@
 #include <raylib.h>
+#include <raylibmathex.h>
 
+#include <ant.hpp>
+#include <food.hpp>
 #include <population.hpp>
 #include <resources.hpp>
 #include <util/serialization.hpp>
@@ -17,6 +20,9 @@ World::World(const nlohmann::json& j, TextureCache& textureCache)
   _bounds = Util::rectangle_from_json(j.at("bounds"));
   _spawnBounds = Util::rectangle_from_json(j.at("spawn_bounds"));
   _spawnMargin = j.at("spawn_margin").get<float>();
+  _inferencePrecision = j.value("inference_precision", NeuralNetwork::FLOAT);
+  _weightFormat = j.value("weight_format", Util::FP32);
+  _pruneThreshold = j.value("prune_threshold", 0.0F);
 
   _resources = Resources(j.at("resources"), *this);
   _population = Population(j.at("population"), *this);
@@ -28,6 +34,9 @@ World::World(const World& other)
   _bounds = other._bounds;
   _spawnBounds = other._spawnBounds;
   _spawnMargin = other._spawnMargin;
+  _inferencePrecision = other._inferencePrecision;
+  _weightFormat = other._weightFormat;
+  _pruneThreshold = other._pruneThreshold;
 
   // Reconstruct resources and population with the new world reference
   _resources = Resources(other._resources);
@@ -40,6 +49,9 @@ World::World(World&& other) noexcept
   _bounds = other._bounds;
   _spawnBounds = other._spawnBounds;
   _spawnMargin = other._spawnMargin;
+  _inferencePrecision = other._inferencePrecision;
+  _weightFormat = other._weightFormat;
+  _pruneThreshold = other._pruneThreshold;
 
   // Move resources and population
   _resources = std::move(other._resources);
@@ -57,6 +69,9 @@ World& World::operator=(const World& other) {
     _bounds = other._bounds;
     _spawnBounds = other._spawnBounds;
     _spawnMargin = other._spawnMargin;
+    _inferencePrecision = other._inferencePrecision;
+    _weightFormat = other._weightFormat;
+    _pruneThreshold = other._pruneThreshold;
 
     // Reconstruct resources and population with the new world reference
     _resources = Resources(other._resources);
@@ -71,6 +86,9 @@ World& World::operator=(World&& other) noexcept {
     _bounds = other._bounds;
     _spawnBounds = other._spawnBounds;
     _spawnMargin = other._spawnMargin;
+    _inferencePrecision = other._inferencePrecision;
+    _weightFormat = other._weightFormat;
+    _pruneThreshold = other._pruneThreshold;
 
     // Move resources and population
     _resources = std::move(other._resources);
@@ -91,6 +109,8 @@ bool World::operator==(const World& other) const {
          _spawnBounds.x == other._spawnBounds.x && _spawnBounds.y == other._spawnBounds.y &&
          _spawnBounds.width == other._spawnBounds.width &&
          _spawnBounds.height == other._spawnBounds.height && _spawnMargin == other._spawnMargin &&
+         _inferencePrecision == other._inferencePrecision &&
+         _weightFormat == other._weightFormat && _pruneThreshold == other._pruneThreshold &&
          _resources == other._resources && _population == other._population;
 }
 
@@ -98,6 +118,11 @@ auto World::get_bounds() const -> const Rectangle& {
   return _bounds;
 }
 
+auto World::set_bounds(const Rectangle& bounds) -> void {
+  _bounds = bounds;
+  update_spawn_rect();
+}
+
 auto World::get_population() const -> const Population& {
   return _population;
 }
@@ -136,18 +161,54 @@ auto World::update_spawn_rect() -> void {
 }
 
 auto World::update(float time) -> void {
-  _resources.update(time);
-  _resources.feed_ants(_population);
-  _population.update(time);
+  _tickProfile.reset();
+  _tickProfile.measure(Util::TickProfile::RESPAWN_FOOD, [&] { _resources.update(time); });
+  _tickProfile.measure(Util::TickProfile::RESOLVE_CONTACTS,
+                       [&] { _resources.feed_ants(_population); });
+  _population.update(time, _tickProfile);
+}
+
+auto World::get_tick_profile() const -> const Util::TickProfile& {
+  return _tickProfile;
+}
+
+auto World::get_tick_profile() -> Util::TickProfile& {
+  return _tickProfile;
 }
 
-auto World::draw() -> void {
+auto World::memory_usage() const -> Util::MemoryUsage {
+  return _resources.memory_usage() + _population.memory_usage() + _labels.memory_usage();
+}
+
+auto World::get_memory_report() const -> MemoryReport {
+  return {.ants = _population.get_ants_memory_usage(),
+          .pangenome = _population.get_pangenome().memory_usage(),
+          .resources = _resources.memory_usage(),
+          .history = _population.get_history_memory_usage(),
+          .total = memory_usage(),
+          .antCount = _population.get_ants().size(),
+          .genomeCount = _population.get_pangenome().size(),
+          .foodCount = _resources.get_food().size()};
+}
+
+auto World::draw(const Camera2D& camera) -> void {
   DrawRectangle(_bounds.x, _bounds.y, _bounds.width, _bounds.height, WHITE);
-  _resources.draw();
-  auto& ants = _population.get_ants();
-  for (const auto& ant : ants) {
-    ant.draw(_textureCache);
+
+  const Rectangle view = GetCameraViewRect(camera, GetScreenWidth(), GetScreenHeight());
+
+  _resources.draw(view, Food::TEXTURE_WIDTH * camera.zoom < MIN_SPRITE_PIXELS);
+
+  Ant::Detail detail = Ant::FULL;
+  if (Ant::TEXTURE_WIDTH * camera.zoom < MIN_SPRITE_PIXELS) {
+    detail = Ant::DOT;
+  } else if (Ant::FONT_SIZE * camera.zoom < MIN_LABEL_PIXELS) {
+    detail = Ant::BODY;
   }
+
+  _population.for_each_in_rect(ExpandRect(view, DRAW_MARGIN), [&](const Ant& ant) {
+    ant.draw(_textureCache, _labels, detail);
+  });
+  _labels.flush();
 }
 
 auto World::out_of_bounds(const Vector2& position) const -> bool {
@@ -167,12 +228,39 @@ auto World::to_json() const -> nlohmann::json {
   j["bounds"] = Util::rectangle_to_json(_bounds);
   j["spawn_bounds"] = Util::rectangle_to_json(_spawnBounds);
   j["spawn_margin"] = _spawnMargin;
+  j["inference_precision"] = _inferencePrecision;
+  j["weight_format"] = _weightFormat;
+  j["prune_threshold"] = _pruneThreshold;
   j["resources"] = _resources.to_json();
   j["population"] = _population.to_json();
 
   return j;
 }
 
+auto World::set_inference_precision(NeuralNetwork::Precision precision) -> void {
+  _inferencePrecision = precision;
+}
+
+auto World::get_inference_precision() const -> NeuralNetwork::Precision {
+  return _inferencePrecision;
+}
+
+auto World::set_prune_threshold(float threshold) -> void {
+  _pruneThreshold = threshold;
+}
+
+auto World::get_prune_threshold() const -> float {
+  return _pruneThreshold;
+}
+
+auto World::set_weight_format(Util::WeightFormat format) -> void {
+  _weightFormat = format;
+}
+
+auto World::get_weight_format() const -> Util::WeightFormat {
+  return _weightFormat;
+}
+
 auto World::get_texture_cache() -> TextureCache& {
   return _textureCache;
 }
@@ -28,9 +28,36 @@ auto BenchmarkBase::display() -> void {
   }
 }
 
+auto BenchmarkBase::set_counters_enabled(bool enabled) -> void {
+  _countersEnabled = enabled;
+}
+
+auto BenchmarkBase::get_counters() const -> const PerfCounters::Sample& {
+  return _counters;
+}
+
+auto BenchmarkBase::get_counter_error() const -> std::string {
+  if (!_countersEnabled) {
+    return "disabled, set BENCHMARK_PERF_COUNTERS=1";
+  }
+  return _perfCounters ? _perfCounters->get_error() : "";
+}
+
 auto BenchmarkBase::run() -> void {
+  if (_countersEnabled && !_perfCounters) {
+    _perfCounters = std::make_unique<PerfCounters>();
+  }
+  const bool counting = _countersEnabled && _perfCounters->is_available();
+
+  // Counters are started outside the timed region so their syscalls are not in the duration
+  if (counting) {
+    _perfCounters->start();
+  }
   auto start = std::chrono::high_resolution_clock::now();
   derived_run();
   auto stop = std::chrono::high_resolution_clock::now();
+  if (counting) {
+    _counters = _perfCounters->stop();
+  }
   _duration = std::chrono::duration<double>(stop - start);
 }
\ No newline at end of file
@@ -2,10 +2,13 @@
 #include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <chrono>
+#include <memory>
 #include <neural_network.hpp>
 #include <neuron.hpp>
 #include <random_generator.hpp>
 
+#include "tests/helpers/perf_counters.hpp"
+
 // Common benchmark setup and utilities
 class BenchmarkBase {
  public:
@@ -18,9 +21,16 @@ class BenchmarkBase {
   auto display() -> void;
   auto set_name(const std::string& name) -> void;
   auto run() -> void;
+  // Hardware counters around derived_run(), on by default when BENCHMARK_PERF_COUNTERS is set
+  auto set_counters_enabled(bool enabled) -> void;
+  auto get_counters() const -> const PerfCounters::Sample&;
+  auto get_counter_error() const -> std::string;
 
  protected:
   virtual auto derived_run() -> void = 0;
   std::chrono::duration<double> _duration;
   std::string _name;
+  bool _countersEnabled = PerfCounters::requested();
+  std::unique_ptr<PerfCounters> _perfCounters;
+  PerfCounters::Sample _counters;
 };
\ No newline at end of file
@@ -0,0 +1,68 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <brain.hpp>
+#include <iostream>
+#include <optional>
+#include <random_generator.hpp>
+#include <string>
+#include <vector>
+
+#include "../world/world_benchmark_base.hpp"
+#include "tests/helpers/benchmark_reporter.hpp"
+
+namespace {
+constexpr size_t FOOD_COUNTS[] = {200, 2000, 20000};
+constexpr size_t SENSES_PER_SAMPLE = 1000;
+constexpr float SENSE_PERIOD = 0.1F;  // Brain's update frequency, so every call re-reads
+}  // namespace
+
+// SENSES_PER_SAMPLE surroundings reads at seeded positions: 100 food_in_rect tiles each
+class BrainSensingBenchmark : public WorldBenchmarkBase {
+ public:
+  BrainSensingBenchmark(const std::string& name, size_t foodCount)
+      : WorldBenchmarkBase(name, foodCount, 0) {
+    build_world();
+    _brain.emplace(*_world, NeuralNetwork());
+
+    RandomGenerator rng(SEED);
+    const Rectangle& bounds = _world->get_bounds();
+    for (size_t i = 0; i < SENSES_PER_SAMPLE; ++i) {
+      _positions.push_back({static_cast<float>(rng.uniform(bounds.x, bounds.x + bounds.width)),
+                            static_cast<float>(rng.uniform(bounds.y, bounds.y + bounds.height))});
+    }
+  }
+
+  auto reset() -> void override {}
+
+ protected:
+  auto derived_run() -> void override {
+    for (const Vector2& position : _positions) {
+      _brain->sense(SENSE_PERIOD, position);
+    }
+  }
+
+  std::optional<Brain> _brain;
+  std::vector<Vector2> _positions;
+};
+
+TEST_CASE("Statistical Brain Sensing Benchmarks", "[brain][benchmark]") {
+  StatisticalBenchmarkRunner::AdaptivePolicy policy;
+  policy.max_seconds = 10.0;
+
+  for (const size_t foodCount : FOOD_COUNTS) {
+    const std::string test_name = "Brain Sensing Benchmark - " + std::to_string(foodCount) +
+                                  " food " + std::to_string(SENSES_PER_SAMPLE) + " Senses";
+    const std::string file_name = "brain_sensing_" + std::to_string(foodCount) + "_benchmark.md";
+    std::cout << "Running: " << test_name << "\n";
+
+    BrainSensingBenchmark benchmark(test_name, foodCount);
+    const auto data = StatisticalBenchmarkRunner::run_adaptive_benchmark(benchmark, policy);
+
+    BenchmarkReporter reporter(test_name, file_name);
+    reporter.set_data(data);
+    reporter.generate_report();
+    reporter.write_to_file();
+
+    std::cout << "Completed: " << test_name << " - Report saved to " << file_name << "\n";
+  }
+}
@@ -0,0 +1,67 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "genome_benchmark_base.hpp"
+#include "tests/helpers/benchmark_reporter.hpp"
+
+namespace {
+constexpr size_t WIDTHS[] = {16, 64, 256};
+}  // namespace
+
+// OPERATIONS children bred from the same two parents, mutation included
+class GenomeBreedBenchmark : public GenomeBenchmarkBase {
+ public:
+  using GenomeBenchmarkBase::GenomeBenchmarkBase;
+
+ protected:
+  auto derived_run() -> void override {
+    for (Genome& child : _genomes) {
+      child = _parentA.breed_with(_parentB, _rng);
+    }
+  }
+};
+
+// OPERATIONS mutations, each of a separate copy of the same parent
+class GenomeMutateBenchmark : public GenomeBenchmarkBase {
+ public:
+  using GenomeBenchmarkBase::GenomeBenchmarkBase;
+
+ protected:
+  auto derived_run() -> void override {
+    for (Genome& genome : _genomes) {
+      genome.mutate();
+    }
+  }
+};
+
+template <typename BenchmarkType>
+auto run_genome_benchmark(const std::string& operation, size_t width) -> void {
+  const std::string test_name = "Genome " + operation + " Benchmark - " + std::to_string(width) +
+                                " wide " + std::to_string(GenomeBenchmarkBase::OPERATIONS) +
+                                " Operations";
+  const std::string file_name =
+      "genome_" + operation + "_" + std::to_string(width) + "_benchmark.md";
+  std::cout << "Running: " << test_name << "\n";
+
+  StatisticalBenchmarkRunner::AdaptivePolicy policy;
+  policy.max_seconds = 10.0;
+  BenchmarkType benchmark(test_name, width);
+  const auto data = StatisticalBenchmarkRunner::run_adaptive_benchmark(benchmark, policy);
+
+  BenchmarkReporter reporter(test_name, file_name);
+  reporter.set_data(data);
+  reporter.generate_report();
+  reporter.write_to_file();
+
+  std::cout << "Completed: " << test_name << " - Report saved to " << file_name << "\n";
+}
+
+TEST_CASE("Statistical Genome Benchmarks", "[genome][benchmark]") {
+  for (const size_t width : WIDTHS) {
+    run_genome_benchmark<GenomeBreedBenchmark>("breed", width);
+    run_genome_benchmark<GenomeMutateBenchmark>("mutate", width);
+  }
+}
@@ -0,0 +1,33 @@
+#include "genome_benchmark_base.hpp"
+
+#include <neural_network.hpp>
+#include <nlohmann/json.hpp>
+
+GenomeBenchmarkBase::GenomeBenchmarkBase(const std::string& name, size_t width)
+    : BenchmarkBase(name), _width(width) {
+  _parentA = make_genome(_width, _rng, 1.0);
+  _parentB = make_genome(_width, _rng, 0.5);
+}
+
+auto GenomeBenchmarkBase::reset() -> void {
+  _genomes.assign(OPERATIONS, _parentA);
+}
+
+auto GenomeBenchmarkBase::make_genome(size_t width, const RandomGenerator& rng, double fitness)
+    -> Genome {
+  NeuralNetwork network;
+  network.set_hidden_layer_neuron_count(width);
+  network.set_hidden_layer_count(2);
+
+  std::vector<Neuron::Value> parameters(network.get_parameter_count());
+  rng.fill_normal(parameters, 0.0F, 0.5F);
+  network.set_parameters(parameters);
+
+  // Genomes only take their network from JSON, the same way saved games restore them
+  nlohmann::json json;
+  json["network"] = network.to_json();
+  json["mutation_rate"] = 0.1;
+  json["fitness"] = fitness;
+  json["children_count"] = 0;
+  return Genome(json);
+}
@@ -0,0 +1,31 @@
+#pragma once
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <genome.hpp>
+#include <random_generator.hpp>
+#include <vector>
+
+#include "../benchmark_base.hpp"
+
+// Base class for genome benchmarks. Parents are built with a hidden layer width and weights
+// drawn from a fixed seed, so every run breeds and mutates the same networks
+class GenomeBenchmarkBase : public BenchmarkBase {
+ public:
+  static constexpr uint64_t SEED = 42;
+  // Genome operations timed per sample
+  static constexpr size_t OPERATIONS = 100;
+
+  GenomeBenchmarkBase(const std::string& name, size_t width);
+  auto reset() -> void override;
+
+  // Genome with two hidden layers of width neurons and normally distributed weights from rng
+  static auto make_genome(size_t width, const RandomGenerator& rng, double fitness = 0.0)
+      -> Genome;
+
+ protected:
+  size_t _width;
+  RandomGenerator _rng{SEED};
+  Genome _parentA;
+  Genome _parentB;
+  std::vector<Genome> _genomes;
+};
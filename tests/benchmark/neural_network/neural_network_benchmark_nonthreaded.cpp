@@ -11,6 +11,9 @@ class NonThreadedNeuralNetworkBenchmark : public NeuralNetworkBenchmarkBase {
  public:
   NonThreadedNeuralNetworkBenchmark() = default;
   NonThreadedNeuralNetworkBenchmark(const std::string& name) : NeuralNetworkBenchmarkBase(name) {};
+
+  // Hidden and output neurons evaluated by one forward pass
+  static constexpr double NEURONS_PER_PASS = HIDDEN_LAYER_SIZE + OUTPUT_LAYER_SIZE;
 };
 
 TEST_CASE("Statistical Non-Threaded Neural Network Benchmarks", "[benchmark]") {
@@ -23,6 +26,9 @@ TEST_CASE("Statistical Non-Threaded Neural Network Benchmarks", "[benchmark]") {
 
     std::vector<double> single_pass_data;
     single_pass_data.reserve(StatisticalBenchmarkRunner::NUM_ITERATIONS);
+    BenchmarkReporter::CounterReport counters{
+        .work_per_iteration = NonThreadedNeuralNetworkBenchmark::NEURONS_PER_PASS,
+        .work_unit = "neuron"};
 
     for (size_t i = 0; i < StatisticalBenchmarkRunner::NUM_ITERATIONS; ++i) {
       NonThreadedNeuralNetworkBenchmark benchmark(test_name);
@@ -30,10 +36,13 @@ TEST_CASE("Statistical Non-Threaded Neural Network Benchmarks", "[benchmark]") {
       benchmark.run();
       // Use nanoseconds for better precision
       single_pass_data.push_back(static_cast<double>(benchmark.get_duration_ns().count()));
+      counters.samples.push_back(benchmark.get_counters());
+      counters.error = benchmark.get_counter_error();
     }
 
     BenchmarkReporter single_reporter(test_name, "single_neural_network_benchmark.md");
     single_reporter.set_data(single_pass_data);
+    single_reporter.set_counters(counters);
     single_reporter.generate_report();
     single_reporter.write_to_file();
 
@@ -48,17 +57,24 @@ TEST_CASE("Statistical Non-Threaded Neural Network Benchmarks", "[benchmark]") {
 
     std::vector<double> multi_pass_data;
     multi_pass_data.reserve(StatisticalBenchmarkRunner::NUM_ITERATIONS);
+    BenchmarkReporter::CounterReport counters{
+        .work_per_iteration = 100 * NonThreadedNeuralNetworkBenchmark::NEURONS_PER_PASS,
+        .work_unit = "neuron"};
 
     for (size_t i = 0; i < StatisticalBenchmarkRunner::NUM_ITERATIONS; ++i) {
       NonThreadedNeuralNetworkBenchmark benchmark(test_name);
 
       // Run 100 forward passes sequentially and measure total time
       std::chrono::nanoseconds total_duration{0};
+      PerfCounters::Sample total_counters;
       for (size_t j = 0; j < 100; ++j) {
         benchmark.reset();
         benchmark.run();
         total_duration += benchmark.get_duration_ns();
+        total_counters += benchmark.get_counters();
       }
+      counters.samples.push_back(total_counters);
+      counters.error = benchmark.get_counter_error();
 
       multi_pass_data.push_back(
           static_cast<double>(total_duration.count()));  // Already in nanoseconds
@@ -66,6 +82,7 @@ TEST_CASE("Statistical Non-Threaded Neural Network Benchmarks", "[benchmark]") {
 
     BenchmarkReporter multi_reporter(test_name, "multiple_neural_network_benchmark.md");
     multi_reporter.set_data(multi_pass_data);
+    multi_reporter.set_counters(counters);
     multi_reporter.generate_report();
     multi_reporter.write_to_file();
 
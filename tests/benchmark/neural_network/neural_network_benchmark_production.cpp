@@ -0,0 +1,85 @@
+#include <array>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <iostream>
+#include <vector>
+
+#include "../benchmark_base.hpp"
+#include "tests/helpers/benchmark_reporter.hpp"
+#include "tests/helpers/static_network.hpp"
+
+// Forward passes through the production 100-16-16-2 brain, once via NeuralNetwork (which
+// selects the static kernel for this shape) and once via the StaticNetwork directly
+class ProductionNetworkBenchmark : public BenchmarkBase {
+ public:
+  ProductionNetworkBenchmark(const std::string& name, bool direct)
+      : BenchmarkBase(name), _direct(direct) {};
+
+  auto reset() -> void override {
+    _network.randomize();
+    std::vector<NeuralNetwork::Layer> hidden;
+    for (size_t index = 0; index < _network.get_hidden_layer_count(); ++index) {
+      hidden.push_back(_network.get_hidden_layer(index));
+    }
+    _staticNetwork.load(hidden, _network.get_output_layer());
+
+    _inputs.resize(PASSES);
+    for (auto& inputs : _inputs) {
+      inputs.resize(ProductionNetwork::INPUTS);
+      for (auto& input : inputs) {
+        input = static_cast<Neuron::Value>(_randomGenerator.uniform(-1.0, 1.0));
+      }
+    }
+    // Build the network's cached kernels outside the timed region
+    _network.set_input_values(_inputs.front());
+    _network.get_output_values();
+  }
+
+ protected:
+  auto derived_run() -> void override {
+    for (const auto& inputs : _inputs) {
+      if (_direct) {
+        _staticNetwork.compute(inputs, _outputs);
+      } else {
+        _network.set_input_values(inputs);
+        _network.get_output_values();
+      }
+    }
+  }
+
+  static constexpr size_t PASSES = 100;
+
+  bool _direct;
+  NeuralNetwork _network;
+  ProductionNetwork _staticNetwork;
+  std::vector<NeuralNetwork::ValueVector> _inputs;
+  std::array<Neuron::Value, ProductionNetwork::OUTPUTS> _outputs{};
+  RandomGenerator _randomGenerator;
+};
+
+TEST_CASE("Statistical Production Network Benchmarks", "[benchmark]") {
+  for (const bool direct : {false, true}) {
+    const std::string test_name = direct
+                                      ? "Production Network Benchmark - StaticNetwork 100 Passes"
+                                      : "Production Network Benchmark - NeuralNetwork 100 Passes";
+    const std::string file_name = direct ? "production_static_network_benchmark.md"
+                                         : "production_neural_network_benchmark.md";
+    std::cout << "Running: " << test_name << "\n";
+
+    std::vector<double> data;
+    data.reserve(StatisticalBenchmarkRunner::NUM_ITERATIONS);
+    for (size_t i = 0; i < StatisticalBenchmarkRunner::NUM_ITERATIONS; ++i) {
+      ProductionNetworkBenchmark benchmark(test_name, direct);
+      benchmark.reset();
+      benchmark.run();
+      data.push_back(static_cast<double>(benchmark.get_duration_ns().count()));
+    }
+
+    BenchmarkReporter reporter(test_name, file_name);
+    reporter.set_data(data);
+    reporter.generate_report();
+    reporter.write_to_file();
+
+    std::cout << "Completed: " << test_name << " - Report saved to " << file_name << "\n";
+  }
+}
@@ -0,0 +1,152 @@
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../benchmark_base.hpp"
+#include "tests/helpers/benchmark_reporter.hpp"
+
+// 100 forward passes through the production brain at the given precision, on sensing-like
+// inputs: mostly empty cells (0) with some walls (-1) and food (+1)
+class QuantizedNetworkBenchmark : public BenchmarkBase {
+ public:
+  QuantizedNetworkBenchmark(const std::string& name, NeuralNetwork::Precision precision)
+      : BenchmarkBase(name), _precision(precision) {};
+
+  auto reset() -> void override {
+    _network.randomize();
+    _network.set_precision(_precision);
+    _inputs.resize(PASSES);
+    for (auto& inputs : _inputs) {
+      inputs.resize(_network.get_input_count());
+      for (auto& input : inputs) {
+        const double cell = _randomGenerator.uniform(0.0, 1.0);
+        input = cell < 0.1 ? -1.0F : cell < 0.2 ? 1.0F : 0.0F;
+      }
+    }
+    // Quantize the weights outside the timed region; INT8 brains drop the floats as Brain does
+    if (_precision == NeuralNetwork::INT8) {
+      _network.release_float_weights();
+    }
+    _network.set_input_values(_inputs.front());
+    _network.get_output_values();
+  }
+
+  // Everything the brain's network owns after running, as memory_usage() reports it
+  auto get_memory_usage() const -> Util::MemoryUsage { return _network.memory_usage(); }
+
+ protected:
+  auto derived_run() -> void override {
+    for (const auto& inputs : _inputs) {
+      _network.set_input_values(inputs);
+      _network.get_output_values();
+    }
+  }
+
+  static constexpr size_t PASSES = 100;
+
+  NeuralNetwork::Precision _precision;
+  NeuralNetwork _network;
+  std::vector<NeuralNetwork::ValueVector> _inputs;
+  RandomGenerator _randomGenerator;
+};
+
+TEST_CASE("Statistical Quantized Neural Network Benchmarks", "[benchmark]") {
+  std::vector<Util::MemoryUsage> usages;
+  for (const auto precision : {NeuralNetwork::FLOAT, NeuralNetwork::INT8}) {
+    const bool int8 = precision == NeuralNetwork::INT8;
+    const std::string test_name = int8 ? "Quantized Neural Network Benchmark - INT8 100 Passes"
+                                       : "Quantized Neural Network Benchmark - FLOAT 100 Passes";
+    const std::string file_name =
+        int8 ? "quantized_int8_network_benchmark.md" : "quantized_float_network_benchmark.md";
+    std::cout << "Running: " << test_name << "\n";
+
+    std::vector<double> data;
+    data.reserve(StatisticalBenchmarkRunner::NUM_ITERATIONS);
+    Util::MemoryUsage usage;
+    for (size_t i = 0; i < StatisticalBenchmarkRunner::NUM_ITERATIONS; ++i) {
+      QuantizedNetworkBenchmark benchmark(test_name, precision);
+      benchmark.reset();
+      benchmark.run();
+      data.push_back(static_cast<double>(benchmark.get_duration_ns().count()));
+      usage = benchmark.get_memory_usage();
+    }
+    usages.push_back(usage);
+
+    BenchmarkReporter reporter(test_name, file_name);
+    reporter.set_data(data);
+    reporter.generate_report();
+    reporter.write_to_file();
+    std::cout << "Completed: " << test_name << " - Report saved to " << file_name << "\n";
+  }
+
+  // Per-brain memory: FLOAT brains hold the float layers plus their ternary columns and static
+  // kernel, INT8 brains the int8 network alone (the genome keeps the floats)
+  const std::string file_name = BenchmarkReporter::output_path("quantized_memory_per_brain.md");
+  std::ofstream file(file_name);
+  file << "# Quantized Neural Network Memory per Brain\n\n";
+  file << "NeuralNetwork::memory_usage() of the production brain after 100 forward passes; "
+          "INT8 brains have released their float weights.\n\n";
+  file << "| Precision | Bytes | Allocations |\n|-----------|-------|-------------|\n";
+  const char* names[] = {"FLOAT", "INT8"};
+  for (size_t index = 0; index < usages.size(); ++index) {
+    file << "| " << names[index] << " | " << usages[index].bytes << " | "
+         << usages[index].allocations << " |\n";
+    std::cout << names[index] << " brain: " << usages[index].bytes << " bytes in "
+              << usages[index].allocations << " allocations\n";
+  }
+  std::cout << "Report saved to " << file_name << "\n";
+}
+
+TEST_CASE("Quantized Neural Network Accuracy Drift", "[benchmark]") {
+  // Velocity error of INT8 brains against their float originals over random genomes and inputs
+  constexpr size_t NETWORKS = 100;
+  constexpr size_t INPUTS_PER_NETWORK = 100;
+  RandomGenerator rng(2024);
+
+  std::vector<double> errors;
+  errors.reserve(NETWORKS * INPUTS_PER_NETWORK * 2);
+  for (size_t n = 0; n < NETWORKS; ++n) {
+    NeuralNetwork network;
+    network.randomize();
+    NeuralNetwork quantized(network);
+    quantized.set_precision(NeuralNetwork::INT8);
+
+    NeuralNetwork::ValueVector inputs(network.get_input_count());
+    for (size_t i = 0; i < INPUTS_PER_NETWORK; ++i) {
+      for (auto& input : inputs) {
+        input = static_cast<Neuron::Value>(rng.uniform(-1.0, 1.0));
+      }
+      network.set_input_values(inputs);
+      quantized.set_input_values(inputs);
+      const auto expected = network.get_output_values();
+      const auto actual = quantized.get_output_values();
+      for (size_t o = 0; o < expected.size(); ++o) {
+        errors.push_back(std::abs(static_cast<double>(actual[o]) - expected[o]));
+      }
+    }
+  }
+
+  std::sort(errors.begin(), errors.end());
+  const double mean = StatisticalBenchmarkRunner::calculate_mean(errors);
+  const double p99 = errors[errors.size() * 99 / 100];
+  const double max = errors.back();
+
+  const std::string file_name = BenchmarkReporter::output_path("quantized_accuracy_drift.md");
+  std::ofstream file(file_name);
+  file << "# Quantized Neural Network Accuracy Drift\n\n";
+  file << "Absolute output error of INT8 against FLOAT inference (outputs in [-1, 1]).\n\n";
+  file << "| Metric | Value |\n|--------|-------|\n";
+  file << "| Samples | " << errors.size() << " |\n";
+  file << "| Mean | " << mean << " |\n";
+  file << "| p99 | " << p99 << " |\n";
+  file << "| Max | " << max << " |\n";
+  std::cout << "INT8 accuracy drift - mean: " << mean << ", p99: " << p99 << ", max: " << max
+            << " - Report saved to " << file_name << "\n";
+
+  REQUIRE(mean < 0.05);
+}
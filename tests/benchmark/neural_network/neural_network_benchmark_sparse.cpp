@@ -0,0 +1,154 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../benchmark_base.hpp"
+#include "tests/helpers/benchmark_reporter.hpp"
+
+namespace {
+constexpr float THRESHOLDS[] = {0.0F, 0.25F, 0.5F, 1.0F, 1.5F};
+
+// Evolved weights cluster around zero; a unit normal stands in for them here
+auto evolved_network(RandomGenerator& rng) -> NeuralNetwork {
+  NeuralNetwork network;
+  network.edit_neurons([&](size_t, size_t, Neuron& neuron) {
+    rng.fill_normal(neuron.get_weights(), 0.0F, 1.0F);
+    neuron.set_bias(rng.uniform(-1.0, 1.0));
+  });
+  return network;
+}
+
+// Sensing inputs: mostly empty cells (0) with some walls (-1) and food (+1)
+auto fill_sensing(RandomGenerator& rng, NeuralNetwork::ValueVector& inputs) -> void {
+  for (auto& input : inputs) {
+    const double cell = rng.uniform(0.0, 1.0);
+    input = cell < 0.1 ? -1.0F : cell < 0.2 ? 1.0F : 0.0F;
+  }
+}
+}  // namespace
+
+// 100 forward passes through the production brain on sensing-like inputs, with weights below
+// threshold pruned; threshold 0 is the default NeuralNetwork path
+class PrunedNetworkBenchmark : public BenchmarkBase {
+ public:
+  PrunedNetworkBenchmark(const std::string& name, float threshold)
+      : BenchmarkBase(name), _threshold(threshold) {};
+
+  auto reset() -> void override {
+    _network = evolved_network(_randomGenerator);
+    _network.set_prune_threshold(_threshold);
+    _inputs.resize(PASSES);
+    for (auto& inputs : _inputs) {
+      inputs.resize(_network.get_input_count());
+      fill_sensing(_randomGenerator, inputs);
+    }
+    // Build the inference copy of the weights outside the timed region
+    _network.set_input_values(_inputs.front());
+    _network.get_output_values();
+  }
+
+  auto get_sparsity() const -> float { return _network.get_sparsity(); }
+  auto get_memory_bytes() const -> size_t { return _network.memory_usage().bytes; }
+
+ protected:
+  auto derived_run() -> void override {
+    for (const auto& inputs : _inputs) {
+      _network.set_input_values(inputs);
+      _network.get_output_values();
+    }
+  }
+
+  static constexpr size_t PASSES = 100;
+
+  float _threshold;
+  NeuralNetwork _network;
+  std::vector<NeuralNetwork::ValueVector> _inputs;
+  RandomGenerator _randomGenerator{7};
+};
+
+TEST_CASE("Statistical Sparse Neural Network Benchmarks", "[benchmark]") {
+  std::vector<double> means;
+  std::vector<float> sparsities;
+  std::vector<size_t> memory;
+  for (const float threshold : THRESHOLDS) {
+    const std::string test_name =
+        "Pruned Neural Network Benchmark - Threshold " + std::to_string(threshold) + " 100 Passes";
+    const std::string file_name =
+        "pruned_network_" + std::to_string(static_cast<int>(threshold * 100)) + "_benchmark.md";
+    std::cout << "Running: " << test_name << "\n";
+
+    std::vector<double> data;
+    data.reserve(StatisticalBenchmarkRunner::NUM_ITERATIONS);
+    float sparsity = 0.0F;
+    size_t bytes = 0;
+    for (size_t i = 0; i < StatisticalBenchmarkRunner::NUM_ITERATIONS; ++i) {
+      PrunedNetworkBenchmark benchmark(test_name, threshold);
+      benchmark.reset();
+      benchmark.run();
+      data.push_back(static_cast<double>(benchmark.get_duration_ns().count()));
+      sparsity = benchmark.get_sparsity();
+      bytes = benchmark.get_memory_bytes();
+    }
+
+    BenchmarkReporter reporter(test_name, file_name);
+    reporter.set_data(data);
+    reporter.generate_report();
+    reporter.write_to_file();
+    means.push_back(StatisticalBenchmarkRunner::calculate_mean(data));
+    sparsities.push_back(sparsity);
+    memory.push_back(bytes);
+    std::cout << "Completed: " << test_name << " - Report saved to " << file_name << "\n";
+  }
+
+  // Behaviour change: output error of each threshold against the unpruned brain
+  constexpr size_t NETWORKS = 50;
+  constexpr size_t INPUTS_PER_NETWORK = 50;
+  RandomGenerator rng(2025);
+  std::vector<double> errors(std::size(THRESHOLDS), 0.0);
+  for (size_t n = 0; n < NETWORKS; ++n) {
+    NeuralNetwork dense = evolved_network(rng);
+    std::vector<NeuralNetwork> pruned;
+    for (const float threshold : THRESHOLDS) {
+      pruned.push_back(dense);
+      pruned.back().set_prune_threshold(threshold);
+    }
+    NeuralNetwork::ValueVector inputs(dense.get_input_count());
+    for (size_t i = 0; i < INPUTS_PER_NETWORK; ++i) {
+      fill_sensing(rng, inputs);
+      dense.set_input_values(inputs);
+      const auto expected = dense.get_output_values();
+      for (size_t t = 0; t < pruned.size(); ++t) {
+        pruned[t].set_input_values(inputs);
+        const auto actual = pruned[t].get_output_values();
+        for (size_t o = 0; o < expected.size(); ++o) {
+          errors[t] += std::abs(static_cast<double>(actual[o]) - expected[o]);
+        }
+      }
+    }
+  }
+
+  const std::string file_name = BenchmarkReporter::output_path("sparse_pruning_tradeoff.md");
+  std::ofstream file(file_name);
+  file << "# Sparse Neural Network Pruning Trade-off\n\n";
+  file << "Production brain with N(0, 1) weights on sensing-like ternary inputs; speedup is "
+          "against the default NeuralNetwork path (threshold 0). Pruned brains drop the weights "
+          "below the threshold and the hidden neurons that can no longer reach the outputs, and "
+          "run the rest from block-sparse storage in place of the ternary columns and static "
+          "kernel. Bytes per brain include the dense float layers kept for evolution.\n\n";
+  file << "| Threshold | Sparsity | Mean (us) | Speedup | Bytes per brain | Mean output error |\n";
+  file << "|-----------|----------|-----------|---------|-----------------|-------------------|\n";
+  const double samples = static_cast<double>(NETWORKS * INPUTS_PER_NETWORK * 2);
+  for (size_t t = 0; t < std::size(THRESHOLDS); ++t) {
+    file << "| " << THRESHOLDS[t] << " | " << sparsities[t] << " | " << means[t] / 1000.0
+         << " | " << means[0] / means[t] << "x | " << memory[t] << " | " << errors[t] / samples
+         << " |\n";
+    std::cout << "Threshold " << THRESHOLDS[t] << " - sparsity: " << sparsities[t]
+              << ", speedup: " << means[0] / means[t] << "x, mean error: " << errors[t] / samples
+              << "\n";
+  }
+}
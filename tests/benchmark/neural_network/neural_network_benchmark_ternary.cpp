@@ -0,0 +1,63 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <iostream>
+#include <vector>
+
+#include "neural_network_benchmark_base.hpp"
+#include "tests/helpers/benchmark_reporter.hpp"
+
+// Forward passes over sensing-like inputs: mostly empty cells with a few food (+1) and
+// wall (-1) cells, which take the ternary first-layer path
+class TernaryNeuralNetworkBenchmark : public NeuralNetworkBenchmarkBase {
+ public:
+  TernaryNeuralNetworkBenchmark() = default;
+  TernaryNeuralNetworkBenchmark(const std::string& name) : NeuralNetworkBenchmarkBase(name) {};
+
+  auto reset() -> void override {
+    setup_network();
+    _inputs.assign(INPUT_LAYER_SIZE, 0.0F);
+    for (auto& input : _inputs) {
+      const double roll = _randomGenerator.uniform();
+      if (roll < FOOD_DENSITY) {
+        input = 1.0F;
+      } else if (roll < FOOD_DENSITY + WALL_DENSITY) {
+        input = -1.0F;
+      }
+    }
+    // Weights stay fixed for an ant's lifetime, so build the transposed first layer untimed
+    _network.set_input_values(_inputs);
+    _network.get_output_values();
+  }
+
+ protected:
+  static constexpr double FOOD_DENSITY = 0.1;
+  static constexpr double WALL_DENSITY = 0.05;
+};
+
+TEST_CASE("Statistical Ternary Input Neural Network Benchmarks", "[benchmark]") {
+  const std::string test_name = "Ternary Input Neural Network Benchmark - 100 Forward Passes";
+  std::cout << "Running: " << test_name << "\n";
+
+  std::vector<double> data;
+  data.reserve(StatisticalBenchmarkRunner::NUM_ITERATIONS);
+
+  for (size_t i = 0; i < StatisticalBenchmarkRunner::NUM_ITERATIONS; ++i) {
+    TernaryNeuralNetworkBenchmark benchmark(test_name);
+
+    std::chrono::nanoseconds total_duration{0};
+    for (size_t j = 0; j < 100; ++j) {
+      benchmark.reset();
+      benchmark.run();
+      total_duration += benchmark.get_duration_ns();
+    }
+    data.push_back(static_cast<double>(total_duration.count()));
+  }
+
+  BenchmarkReporter reporter(test_name, "ternary_neural_network_benchmark.md");
+  reporter.set_data(data);
+  reporter.generate_report();
+  reporter.write_to_file();
+
+  std::cout << "Completed: " << test_name
+            << " - Report saved to ternary_neural_network_benchmark.md\n";
+}
@@ -0,0 +1,101 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <iostream>
+#include <pangenome.hpp>
+#include <string>
+#include <vector>
+
+#include "../genome/genome_benchmark_base.hpp"
+#include "tests/helpers/benchmark_reporter.hpp"
+
+namespace {
+constexpr size_t PANGENOME_SIZES[] = {10, 50, Pangenome::MAX_PANGENOME_SIZE};
+constexpr size_t WIDTHS[] = {16, 64};
+}  // namespace
+
+// A pangenome filled to a size with seeded genomes and fitness values, restored before every
+// sample so additions and samples always start from the same ranking
+class PangenomeBenchmarkBase : public BenchmarkBase {
+ public:
+  PangenomeBenchmarkBase(const std::string& name, size_t size, size_t width)
+      : BenchmarkBase(name) {
+    for (size_t i = 0; i < size; ++i) {
+      _filled.add(GenomeBenchmarkBase::make_genome(width, _rng, _rng.uniform()));
+    }
+    for (size_t i = 0; i < GenomeBenchmarkBase::OPERATIONS; ++i) {
+      _candidates.push_back(GenomeBenchmarkBase::make_genome(width, _rng, _rng.uniform()));
+    }
+  }
+
+  auto reset() -> void override {
+    _pangenome = _filled;
+    _incoming = _candidates;
+  }
+
+ protected:
+  RandomGenerator _rng{GenomeBenchmarkBase::SEED};
+  Pangenome _filled;
+  Pangenome _pangenome;
+  std::vector<Genome> _candidates;
+  std::vector<Genome> _incoming;
+  double _fitnessSum = 0.0;  // keeps the sampled genomes observable
+};
+
+// Adds OPERATIONS retired genomes, trimming the least fit once the pangenome is full
+class PangenomeAddBenchmark : public PangenomeBenchmarkBase {
+ public:
+  using PangenomeBenchmarkBase::PangenomeBenchmarkBase;
+
+ protected:
+  auto derived_run() -> void override {
+    for (Genome& genome : _incoming) {
+      _pangenome.add(std::move(genome));
+    }
+  }
+};
+
+// Picks OPERATIONS parent pairs the way Population breeds them
+class PangenomeSampleBenchmark : public PangenomeBenchmarkBase {
+ public:
+  using PangenomeBenchmarkBase::PangenomeBenchmarkBase;
+
+ protected:
+  auto derived_run() -> void override {
+    for (size_t i = 0; i < GenomeBenchmarkBase::OPERATIONS && !_pangenome.empty(); ++i) {
+      _fitnessSum += _pangenome.sample_top_cycle().get_fitness();
+      _fitnessSum += _pangenome.sample_random().get_fitness();
+    }
+  }
+};
+
+template <typename BenchmarkType>
+auto run_pangenome_benchmark(const std::string& operation, size_t size, size_t width) -> void {
+  const std::string test_name = "Pangenome " + operation + " Benchmark - " +
+                                std::to_string(size) + " genomes " + std::to_string(width) +
+                                " wide " + std::to_string(GenomeBenchmarkBase::OPERATIONS) +
+                                " Operations";
+  const std::string file_name = "pangenome_" + operation + "_" + std::to_string(size) + "_" +
+                                std::to_string(width) + "_benchmark.md";
+  std::cout << "Running: " << test_name << "\n";
+
+  StatisticalBenchmarkRunner::AdaptivePolicy policy;
+  policy.max_seconds = 10.0;
+  BenchmarkType benchmark(test_name, size, width);
+  const auto data = StatisticalBenchmarkRunner::run_adaptive_benchmark(benchmark, policy);
+
+  BenchmarkReporter reporter(test_name, file_name);
+  reporter.set_data(data);
+  reporter.generate_report();
+  reporter.write_to_file();
+
+  std::cout << "Completed: " << test_name << " - Report saved to " << file_name << "\n";
+}
+
+TEST_CASE("Statistical Pangenome Benchmarks", "[pangenome][benchmark]") {
+  for (const size_t width : WIDTHS) {
+    for (const size_t size : PANGENOME_SIZES) {
+      run_pangenome_benchmark<PangenomeAddBenchmark>("add", size, width);
+      run_pangenome_benchmark<PangenomeSampleBenchmark>("sample", size, width);
+    }
+  }
+}
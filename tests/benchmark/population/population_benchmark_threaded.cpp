@@ -0,0 +1,150 @@
+#include <tbb/global_control.h>
+#include <tbb/info.h>
+
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../benchmark_base.hpp"
+#include "tests/helpers/benchmark_reporter.hpp"
+#include "tests/helpers/headless_texture_cache.hpp"
+#include "world.hpp"
+
+namespace {
+constexpr size_t POPULATION_SIZES[] = {100, 1000, 10000, 100000};
+constexpr float TIME_DELTA = 0.016f;  // 60 FPS timing
+// Ticks run before sampling so every ant has sensed at least once
+constexpr size_t WARM_UP_TICKS = 10;
+
+// 1, 2, 4 ... threads, ending with everything TBB would use by default
+auto thread_counts() -> std::vector<size_t> {
+  const auto available = static_cast<size_t>(tbb::info::default_concurrency());
+  std::vector<size_t> counts;
+  for (size_t threads = 1; threads < available; threads *= 2) {
+    counts.push_back(threads);
+  }
+  counts.push_back(available);
+  return counts;
+}
+
+// Small populations tick many times per sample so each sample covers a similar amount of work
+auto ticks_per_sample(size_t populationSize) -> size_t {
+  return std::clamp<size_t>(10000 / populationSize, 1, 100);
+}
+
+typedef enum Scope { POPULATION_UPDATE = 0, WORLD_UPDATE } Scope;
+}  // namespace
+
+// Steady-state ticks of a full-size population; setup happens once in reset(), so successive
+// samples continue the same simulation
+class ThreadScalingBenchmark : public BenchmarkBase {
+ public:
+  ThreadScalingBenchmark(const std::string& name, Scope scope, size_t populationSize)
+      : BenchmarkBase(name), _scope(scope), _populationSize(populationSize) {}
+
+  auto reset() -> void override {
+    _world = std::make_unique<World>(_textureCache);
+    _world->get_population().set_size(static_cast<int>(_populationSize));
+    for (size_t i = 0; i < WARM_UP_TICKS; ++i) {
+      _world->update(TIME_DELTA);
+    }
+  }
+
+ protected:
+  auto derived_run() -> void override {
+    const size_t ticks = ticks_per_sample(_populationSize);
+    for (size_t i = 0; i < ticks; ++i) {
+      if (_scope == WORLD_UPDATE) {
+        _world->update(TIME_DELTA);
+      } else {
+        _world->get_population().update(TIME_DELTA);
+      }
+    }
+  }
+
+  Scope _scope;
+  size_t _populationSize;
+  HeadlessTextureCache _textureCache;
+  std::unique_ptr<World> _world;
+};
+
+namespace {
+auto run_scaling_benchmark(Scope scope, size_t populationSize, std::ofstream& summary) -> void {
+  const std::string scope_name = scope == WORLD_UPDATE ? "World Update" : "Population Update";
+  const std::string file_scope = scope == WORLD_UPDATE ? "world" : "population";
+  const std::string test_name = "Thread Scaling " + scope_name + " Benchmark - " +
+                                std::to_string(populationSize) + " ants " +
+                                std::to_string(ticks_per_sample(populationSize)) + " Ticks";
+  const std::string file_name = "thread_scaling_" + file_scope + "_" +
+                                std::to_string(populationSize) + "_benchmark.md";
+  std::cout << "Running: " << test_name << "\n";
+
+  std::vector<BenchmarkReporter::ScalingRun> runs;
+  for (const size_t threads : thread_counts()) {
+    tbb::global_control limit(tbb::global_control::max_allowed_parallelism, threads);
+    ThreadScalingBenchmark benchmark(test_name, scope, populationSize);
+    benchmark.reset();
+
+    BenchmarkReporter::ScalingRun run{threads, {}};
+    run.data.reserve(StatisticalBenchmarkRunner::NUM_ITERATIONS);
+    for (size_t i = 0; i < StatisticalBenchmarkRunner::NUM_ITERATIONS; ++i) {
+      benchmark.run();
+      run.data.push_back(static_cast<double>(benchmark.get_duration_ns().count()));
+    }
+    runs.push_back(std::move(run));
+  }
+
+  // The summary statistics describe the run with every thread available
+  BenchmarkReporter reporter(test_name, file_name);
+  reporter.set_data(runs.back().data);
+  reporter.set_scaling_runs(runs);
+  reporter.generate_report();
+  reporter.write_to_file();
+
+  const double baseline = StatisticalBenchmarkRunner::calculate_mean(runs.front().data);
+  summary << "| " << scope_name << " | " << populationSize;
+  for (const auto& run : runs) {
+    const double speedup = baseline / StatisticalBenchmarkRunner::calculate_mean(run.data);
+    summary << " | " << speedup << "x (" << 100.0 * speedup / static_cast<double>(run.threads)
+            << "%)";
+  }
+  summary << " |\n";
+
+  std::cout << "Completed: " << test_name << " - Report saved to " << file_name << "\n";
+}
+
+auto write_summary_header(std::ofstream& summary) -> void {
+  summary << "# Thread Scaling Summary\n\n";
+  summary << "Speedup over one thread, with parallel efficiency in brackets.\n\n";
+  summary << "| Scope | Ants";
+  for (const size_t threads : thread_counts()) {
+    summary << " | " << threads << " threads";
+  }
+  summary << " |\n|-------|------";
+  for (size_t i = 0; i < thread_counts().size(); ++i) {
+    summary << "|---------";
+  }
+  summary << "|\n";
+  summary.precision(2);
+  summary << std::fixed;
+}
+}  // namespace
+
+TEST_CASE("Statistical Thread Scaling Population Benchmarks", "[population][benchmark]") {
+  std::ofstream summary(BenchmarkReporter::output_path("thread_scaling_summary.md"));
+  write_summary_header(summary);
+
+  for (const size_t populationSize : POPULATION_SIZES) {
+    run_scaling_benchmark(POPULATION_UPDATE, populationSize, summary);
+  }
+  for (const size_t populationSize : POPULATION_SIZES) {
+    run_scaling_benchmark(WORLD_UPDATE, populationSize, summary);
+  }
+
+  std::cout << "Thread scaling summary written to: thread_scaling_summary.md\n";
+}
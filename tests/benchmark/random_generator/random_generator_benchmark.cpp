@@ -0,0 +1,104 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <iostream>
+#include <vector>
+
+#include "../benchmark_base.hpp"
+#include "random_generator.hpp"
+#include "tests/helpers/benchmark_reporter.hpp"
+
+// Generates VALUES random numbers either one call at a time through the std distributions or
+// with the bulk fill_* functions
+class RandomGeneratorBenchmark : public BenchmarkBase {
+ public:
+  typedef enum Kind { UNIFORM = 0, NORMAL, BERNOULLI } Kind;
+
+  RandomGeneratorBenchmark(const std::string& name, Kind kind, bool bulk)
+      : BenchmarkBase(name), _kind(kind), _bulk(bulk) {};
+
+  auto reset() -> void override {
+    _values.assign(VALUES, 0.0F);
+    _masks.assign(VALUES / 64, 0);
+  }
+
+ protected:
+  auto derived_run() -> void override {
+    switch (_kind) {
+      case UNIFORM:
+        if (_bulk) {
+          _randomGenerator.fill_uniform(_values, -3.0F, 3.0F);
+        } else {
+          for (auto& value : _values) {
+            value = static_cast<float>(_randomGenerator.uniform(-3.0, 3.0));
+          }
+        }
+        break;
+      case NORMAL:
+        if (_bulk) {
+          _randomGenerator.fill_normal(_values, 0.0F, 0.1F);
+        } else {
+          for (auto& value : _values) {
+            value = static_cast<float>(_randomGenerator.normal(0.0, 0.1));
+          }
+        }
+        break;
+      case BERNOULLI:
+        // 64 decisions with probability 0.1 per mask, as for per-weight mutation
+        for (auto& mask : _masks) {
+          if (_bulk) {
+            mask = _randomGenerator.bernoulli_mask(0.1);
+          } else {
+            mask = 0;
+            for (size_t bit = 0; bit < 64; ++bit) {
+              mask |= static_cast<uint64_t>(_randomGenerator.uniform() < 0.1) << bit;
+            }
+          }
+        }
+        break;
+    }
+  }
+
+  static constexpr size_t VALUES = 1 << 16;
+
+  Kind _kind;
+  bool _bulk;
+  std::vector<float> _values;
+  std::vector<uint64_t> _masks;
+  RandomGenerator _randomGenerator{42};
+};
+
+TEST_CASE("Statistical Random Generator Benchmarks", "[benchmark]") {
+  const struct {
+    RandomGeneratorBenchmark::Kind kind;
+    const char* name;
+    const char* file;
+  } kinds[] = {{RandomGeneratorBenchmark::UNIFORM, "Uniform", "uniform"},
+               {RandomGeneratorBenchmark::NORMAL, "Normal", "normal"},
+               {RandomGeneratorBenchmark::BERNOULLI, "Bernoulli Mask", "bernoulli_mask"}};
+
+  for (const auto& kind : kinds) {
+    for (const bool bulk : {false, true}) {
+      const std::string test_name = std::string("Random Generator Benchmark - ") + kind.name +
+                                    (bulk ? " Bulk" : " Per Call") + " 65536 Values";
+      const std::string file_name = std::string("random_") + kind.file +
+                                    (bulk ? "_bulk" : "_per_call") + "_benchmark.md";
+      std::cout << "Running: " << test_name << "\n";
+
+      std::vector<double> data;
+      data.reserve(StatisticalBenchmarkRunner::NUM_ITERATIONS);
+      for (size_t i = 0; i < StatisticalBenchmarkRunner::NUM_ITERATIONS; ++i) {
+        RandomGeneratorBenchmark benchmark(test_name, kind.kind, bulk);
+        benchmark.reset();
+        benchmark.run();
+        data.push_back(static_cast<double>(benchmark.get_duration_ns().count()));
+      }
+
+      BenchmarkReporter reporter(test_name, file_name);
+      reporter.set_data(data);
+      reporter.generate_report();
+      reporter.write_to_file();
+
+      std::cout << "Completed: " << test_name << " - Report saved to " << file_name << "\n";
+    }
+  }
+}
@@ -0,0 +1,58 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <iostream>
+#include <string>
+
+#include "../world/world_benchmark_base.hpp"
+#include "tests/helpers/benchmark_reporter.hpp"
+
+namespace {
+constexpr size_t FOOD_COUNTS[] = {200, 2000};
+constexpr size_t POPULATION_SIZES[] = {100, 1000, 10000};
+}  // namespace
+
+// One feed_ants() pass over a seeded world whose ants stand still. The food eaten by the
+// previous sample is respawned outside the timed region
+class ResourcesFeedingBenchmark : public WorldBenchmarkBase {
+ public:
+  using WorldBenchmarkBase::WorldBenchmarkBase;
+
+  auto reset() -> void override {
+    if (!_world) {
+      build_world();
+    } else {
+      _world->get_resources().respawn_food();
+    }
+  }
+
+ protected:
+  auto derived_run() -> void override {
+    _world->get_resources().feed_ants(_world->get_population());
+  }
+};
+
+TEST_CASE("Statistical Resources Feeding Benchmarks", "[resources][benchmark]") {
+  StatisticalBenchmarkRunner::AdaptivePolicy policy;
+  policy.max_seconds = 10.0;
+
+  for (const size_t foodCount : FOOD_COUNTS) {
+    for (const size_t populationSize : POPULATION_SIZES) {
+      const std::string test_name = "Resources Feeding Benchmark - " +
+                                    std::to_string(foodCount) + " food " +
+                                    std::to_string(populationSize) + " ants";
+      const std::string file_name = "resources_feeding_" + std::to_string(foodCount) + "_" +
+                                    std::to_string(populationSize) + "_benchmark.md";
+      std::cout << "Running: " << test_name << "\n";
+
+      ResourcesFeedingBenchmark benchmark(test_name, foodCount, populationSize);
+      const auto data = StatisticalBenchmarkRunner::run_adaptive_benchmark(benchmark, policy);
+
+      BenchmarkReporter reporter(test_name, file_name);
+      reporter.set_data(data);
+      reporter.generate_report();
+      reporter.write_to_file();
+
+      std::cout << "Completed: " << test_name << " - Report saved to " << file_name << "\n";
+    }
+  }
+}
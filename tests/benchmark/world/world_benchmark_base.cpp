@@ -0,0 +1,22 @@
+#include "world_benchmark_base.hpp"
+
+#include <raylib.h>
+
+WorldBenchmarkBase::WorldBenchmarkBase(const std::string& name, size_t foodCount,
+                                       size_t populationSize)
+    : BenchmarkBase(name), _foodCount(foodCount), _populationSize(populationSize) {}
+
+auto WorldBenchmarkBase::build_world() -> void {
+  SetRandomSeed(SEED);
+  _world = std::make_unique<World>(_textureCache);
+  _world->set_bounds(_bounds);
+
+  Resources& resources = _world->get_resources();
+  resources.set_food_count(static_cast<int>(_foodCount));
+  resources.update(0.0F);
+
+  // A zero-length update creates the ants without moving them
+  Population& population = _world->get_population();
+  population.set_size(static_cast<int>(_populationSize));
+  population.update(0.0F);
+}
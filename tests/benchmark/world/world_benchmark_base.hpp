@@ -0,0 +1,27 @@
+#pragma once
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <world.hpp>
+
+#include "../benchmark_base.hpp"
+#include "tests/helpers/headless_texture_cache.hpp"
+
+// Base class for benchmarks on a headless world. Food and ants are placed right after seeding
+// raylib's generator, so every run and every build starts from the same layout
+class WorldBenchmarkBase : public BenchmarkBase {
+ public:
+  static constexpr unsigned int SEED = 42;
+
+  WorldBenchmarkBase(const std::string& name, size_t foodCount, size_t populationSize);
+
+ protected:
+  // Replaces the world with a fresh seeded one
+  auto build_world() -> void;
+
+  size_t _foodCount;
+  size_t _populationSize;
+  Rectangle _bounds{0.0F, 0.0F, 1000.0F, 1000.0F};  // the default world's
+  HeadlessTextureCache _textureCache;
+  std::unique_ptr<World> _world;
+};
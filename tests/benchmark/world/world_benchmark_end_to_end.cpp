@@ -0,0 +1,176 @@
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <pangenome.hpp>
+#include <string>
+#include <vector>
+
+#include "tests/helpers/benchmark_reporter.hpp"
+#include "world_benchmark_base.hpp"
+
+namespace {
+constexpr float WORLD_SIZES[] = {1000.0F, 2000.0F, 4000.0F};
+// Ants per million square units; the food density is the default world's
+constexpr size_t ANT_DENSITIES[] = {100, 1000};
+constexpr size_t FOOD_DENSITY = 200;
+constexpr float TIME_DELTA = 0.016f;  // 60 FPS timing
+// Warm-up fast-forwards in coarser steps; it only has to reach a full pangenome
+constexpr float WARM_UP_TIME_DELTA = 0.5F;
+constexpr size_t MAX_WARM_UP_TICKS = 50000;
+
+auto per_area(size_t density, float size) -> size_t {
+  return static_cast<size_t>(static_cast<double>(density) * size * size / 1e6);
+}
+
+// Small populations tick many times per sample so each sample covers a similar amount of work
+auto ticks_per_sample(size_t populationSize) -> size_t {
+  return std::clamp<size_t>(100000 / populationSize, 1, 100);
+}
+
+struct ScalingPoint {
+  float worldSize;
+  size_t ants;
+  size_t food;
+  size_t warmUpTicks;
+  size_t pangenomeSize;
+  double nsPerTick;
+  double bytesPerAnt;
+};
+
+auto memory_report(const World::MemoryReport& memory) -> BenchmarkReporter::MemoryReport {
+  return {.parts = {{"ants", memory.ants, memory.antCount, "ant"},
+                    {"pangenome", memory.pangenome, memory.genomeCount, "genome"},
+                    {"resources", memory.resources, memory.foodCount, "food"},
+                    {"history", memory.history, Population::HISTORY_SERIES_COUNT, "series"},
+                    {"world", memory.total}}};
+}
+}  // namespace
+
+// Whole-world ticks of a seeded headless world in its steady state. The first reset() runs
+// the simulation until the pangenome is full, so ants are bred from it rather than created at
+// random, and later samples continue the same simulation
+class EndToEndTickBenchmark : public WorldBenchmarkBase {
+ public:
+  EndToEndTickBenchmark(const std::string& name, float worldSize, size_t foodCount,
+                        size_t populationSize)
+      : WorldBenchmarkBase(name, foodCount, populationSize) {
+    _bounds = {0.0F, 0.0F, worldSize, worldSize};
+  }
+
+  auto reset() -> void override {
+    if (_world) {
+      return;
+    }
+    build_world();
+    const Population& population = _world->get_population();
+    while (population.get_pangenome().size() < Pangenome::MAX_PANGENOME_SIZE &&
+           _warmUpTicks < MAX_WARM_UP_TICKS) {
+      _world->update(WARM_UP_TIME_DELTA);
+      ++_warmUpTicks;
+    }
+  }
+
+  auto get_warm_up_ticks() const -> size_t { return _warmUpTicks; }
+  auto get_pangenome_size() const -> size_t {
+    return _world->get_population().get_pangenome().size();
+  }
+  auto get_memory_report() const -> World::MemoryReport { return _world->get_memory_report(); }
+
+ protected:
+  auto derived_run() -> void override {
+    for (size_t i = 0; i < ticks_per_sample(_populationSize); ++i) {
+      _world->update(TIME_DELTA);
+    }
+  }
+
+  size_t _warmUpTicks = 0;
+};
+
+namespace {
+auto run_end_to_end_benchmark(float worldSize, size_t antDensity) -> ScalingPoint {
+  const size_t ants = per_area(antDensity, worldSize);
+  const size_t food = per_area(FOOD_DENSITY, worldSize);
+  const size_t ticks = ticks_per_sample(ants);
+  const auto size = static_cast<size_t>(worldSize);
+  const std::string test_name = "End-to-End Tick Benchmark - " + std::to_string(size) +
+                                " world " + std::to_string(ants) + " ants " +
+                                std::to_string(food) + " food " + std::to_string(ticks) +
+                                " Ticks";
+  const std::string file_name = "end_to_end_" + std::to_string(size) + "_" +
+                                std::to_string(ants) + "_benchmark.md";
+  std::cout << "Running: " << test_name << "\n";
+
+  StatisticalBenchmarkRunner::AdaptivePolicy policy;
+  policy.max_seconds = 20.0;
+  EndToEndTickBenchmark benchmark(test_name, worldSize, food, ants);
+  BenchmarkReporter::CounterReport counters{
+      .work_per_iteration = static_cast<double>(ants * ticks), .work_unit = "ant tick"};
+  const auto data =
+      StatisticalBenchmarkRunner::run_adaptive_benchmark(benchmark, policy, &counters.samples);
+  counters.error = benchmark.get_counter_error();
+  const World::MemoryReport memory = benchmark.get_memory_report();
+
+  BenchmarkReporter reporter(test_name, file_name);
+  reporter.set_data(data);
+  reporter.set_counters(counters);
+  reporter.set_memory(memory_report(memory));
+  reporter.generate_report();
+  reporter.write_to_file();
+
+  const ScalingPoint point{worldSize,
+                           ants,
+                           food,
+                           benchmark.get_warm_up_ticks(),
+                           benchmark.get_pangenome_size(),
+                           StatisticalBenchmarkRunner::calculate_median(data) /
+                               static_cast<double>(ticks),
+                           static_cast<double>(memory.ants.bytes) /
+                               static_cast<double>(std::max<size_t>(memory.antCount, 1))};
+  std::cout << "Completed: " << test_name << " - " << point.warmUpTicks
+            << " warm-up ticks, pangenome " << point.pangenomeSize << ", "
+            << 1e9 / point.nsPerTick << " ticks/s - Report saved to " << file_name << "\n";
+  return point;
+}
+
+auto write_summary(std::vector<ScalingPoint> points) -> void {
+  std::sort(points.begin(), points.end(),
+            [](const auto& a, const auto& b) { return a.ants < b.ants; });
+
+  const std::string file_name = BenchmarkReporter::output_path("end_to_end_scaling_summary.md");
+  std::ofstream summary(file_name);
+  summary << "# End-to-End Tick Scaling Summary\n\n";
+  summary << "Median steady-state world ticks after warming up until the pangenome holds "
+          << Pangenome::MAX_PANGENOME_SIZE << " genomes, ordered by population. A flat "
+          << "ns/ant-tick column means a tick scales linearly with the ants. KiB/ant is the "
+          << "heap each ant holds with its genome, brain and share of the spatial index.\n\n";
+  summary << "| Ants | World | Food | Warm-up Ticks | Pangenome | Ticks/s | Ant Updates/s | "
+             "ns/ant-tick | KiB/ant |\n";
+  summary << "|------|-------|------|---------------|-----------|---------|---------------|"
+             "-------------|---------|\n";
+  summary << std::fixed;
+  for (const ScalingPoint& point : points) {
+    const double ticksPerSecond = 1e9 / point.nsPerTick;
+    summary << "| " << point.ants << " | " << static_cast<size_t>(point.worldSize) << "x"
+            << static_cast<size_t>(point.worldSize) << " | " << point.food << " | "
+            << point.warmUpTicks << " | " << point.pangenomeSize << " | "
+            << std::setprecision(1) << ticksPerSecond << " | " << std::setprecision(0)
+            << ticksPerSecond * static_cast<double>(point.ants) << " | " << std::setprecision(2)
+            << point.nsPerTick / static_cast<double>(point.ants) << " | "
+            << point.bytesPerAnt / 1024.0 << " |\n";
+  }
+  std::cout << "End-to-end scaling summary written to: " << file_name << "\n";
+}
+}  // namespace
+
+TEST_CASE("Statistical End-to-End Tick Benchmarks", "[world][benchmark]") {
+  std::vector<ScalingPoint> points;
+  for (const float worldSize : WORLD_SIZES) {
+    for (const size_t antDensity : ANT_DENSITIES) {
+      points.push_back(run_end_to_end_benchmark(worldSize, antDensity));
+    }
+  }
+  write_summary(points);
+}
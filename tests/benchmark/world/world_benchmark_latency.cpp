@@ -0,0 +1,125 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <array>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../benchmark_base.hpp"
+#include "tests/helpers/benchmark_reporter.hpp"
+#include "tests/helpers/headless_texture_cache.hpp"
+#include "tests/helpers/latency_histogram.hpp"
+#include "util/allocation_counter.hpp"
+#include "world.hpp"
+
+namespace {
+constexpr size_t POPULATION_SIZES[] = {100, 1000, 10000};
+constexpr float TIME_DELTA = 0.016f;  // 60 FPS timing
+constexpr size_t TICKS_PER_SAMPLE = 100;
+constexpr size_t ALLOCATION_TICKS = 1000;
+}  // namespace
+
+// Batches of TICKS_PER_SAMPLE world ticks that also record every tick into a histogram. The
+// world is built on the first reset() and then keeps running, so later samples see the
+// steady state rather than a fresh population
+class WorldTickLatencyBenchmark : public BenchmarkBase {
+ public:
+  WorldTickLatencyBenchmark(const std::string& name, size_t populationSize, size_t warmUpTicks)
+      : BenchmarkBase(name), _populationSize(populationSize) {
+    _histogram.set_warm_up(warmUpTicks);
+  }
+
+  auto reset() -> void override {
+    if (!_world) {
+      _world = std::make_unique<World>(_textureCache);
+      _world->get_population().set_size(static_cast<int>(_populationSize));
+    }
+  }
+
+  auto get_histogram() const -> const LatencyHistogram& { return _histogram; }
+
+  // Ticks the warmed-up world with its phases one after another, so each phase is charged
+  // only its own allocations. Kept apart from the timed samples, which keep the overlap
+  auto count_allocations(size_t ticks) -> BenchmarkReporter::AllocationReport {
+    Util::TickProfile& profile = _world->get_tick_profile();
+    profile.set_exclusive(true);
+    std::array<Util::AllocationCounter::Counts, Util::TickProfile::PHASE_COUNT> phases{};
+    Util::AllocationCounter::Counts total;
+    for (size_t tick = 0; tick < ticks; ++tick) {
+      const auto before = Util::AllocationCounter::get();
+      _world->update(TIME_DELTA);
+      total += Util::AllocationCounter::get() - before;
+      for (size_t phase = 0; phase < Util::TickProfile::PHASE_COUNT; ++phase) {
+        phases[phase] += profile.get_allocations(static_cast<Util::TickProfile::Phase>(phase));
+      }
+    }
+    profile.set_exclusive(false);
+
+    BenchmarkReporter::AllocationReport report{.iterations = ticks, .iteration_unit = "tick"};
+    for (size_t phase = 0; phase < Util::TickProfile::PHASE_COUNT; ++phase) {
+      report.phases.push_back(
+          {std::string(Util::TickProfile::name(static_cast<Util::TickProfile::Phase>(phase))),
+           phases[phase]});
+    }
+    // Includes the bookkeeping between phases
+    report.phases.push_back({"whole tick", total});
+    return report;
+  }
+
+ protected:
+  auto derived_run() -> void override {
+    for (size_t i = 0; i < TICKS_PER_SAMPLE; ++i) {
+      const auto start = std::chrono::steady_clock::now();
+      _world->update(TIME_DELTA);
+      const auto stop = std::chrono::steady_clock::now();
+      _histogram.record(static_cast<uint64_t>(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count()));
+    }
+  }
+
+  size_t _populationSize;
+  HeadlessTextureCache _textureCache;
+  std::unique_ptr<World> _world;
+  LatencyHistogram _histogram;
+};
+
+TEST_CASE("Statistical World Tick Latency Benchmarks", "[world][benchmark]") {
+  StatisticalBenchmarkRunner::AdaptivePolicy policy;
+  policy.max_seconds = 30.0;
+
+  for (const size_t populationSize : POPULATION_SIZES) {
+    const std::string test_name = "World Tick Latency Benchmark - " +
+                                  std::to_string(populationSize) + " ants " +
+                                  std::to_string(TICKS_PER_SAMPLE) + " Ticks";
+    const std::string file_name =
+        "world_tick_latency_" + std::to_string(populationSize) + "_benchmark.md";
+    std::cout << "Running: " << test_name << "\n";
+
+    // The histogram discards exactly the ticks of the runner's warm-up batches
+    WorldTickLatencyBenchmark benchmark(test_name, populationSize,
+                                        policy.warm_up * TICKS_PER_SAMPLE);
+    BenchmarkReporter::CounterReport counters{
+        .work_per_iteration = static_cast<double>(populationSize * TICKS_PER_SAMPLE),
+        .work_unit = "ant tick"};
+    const auto data =
+        StatisticalBenchmarkRunner::run_adaptive_benchmark(benchmark, policy, &counters.samples);
+    counters.error = benchmark.get_counter_error();
+
+    BenchmarkReporter reporter(test_name, file_name);
+    reporter.set_data(data);
+    reporter.set_histogram(benchmark.get_histogram());
+    reporter.set_counters(counters);
+    reporter.set_allocations(benchmark.count_allocations(ALLOCATION_TICKS));
+    reporter.generate_report();
+    reporter.write_to_file();
+
+    const auto& histogram = benchmark.get_histogram();
+    std::cout << "Completed: " << test_name << " - " << data.size() << " samples, p50 "
+              << histogram.percentile(50.0) / 1000 << " us, p99 "
+              << histogram.percentile(99.0) / 1000 << " us, p99.9 "
+              << histogram.percentile(99.9) / 1000 << " us - Report saved to " << file_name
+              << "\n";
+  }
+}
@@ -0,0 +1,109 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <filesystem>
+#include <iostream>
+#include <nlohmann/json.hpp>
+#include <pangenome.hpp>
+#include <string>
+#include <util/file.hpp>
+
+#include "../genome/genome_benchmark_base.hpp"
+#include "tests/helpers/benchmark_reporter.hpp"
+#include "world_benchmark_base.hpp"
+
+namespace {
+constexpr size_t POPULATION_SIZES[] = {100, 1000};
+constexpr size_t FOOD_COUNT = 200;
+constexpr size_t GENOME_WIDTH = 16;  // NeuralNetwork's default hidden layer width
+}  // namespace
+
+// A seeded world with a full pangenome written to and read from a save file, doing the work
+// of Game::save_game and Game::load_game without the window a Game needs
+class WorldSerializationBenchmark : public WorldBenchmarkBase {
+ public:
+  WorldSerializationBenchmark(const std::string& name, size_t populationSize)
+      : WorldBenchmarkBase(name, FOOD_COUNT, populationSize),
+        _path((std::filesystem::temp_directory_path() / "neural_ants_benchmark_save.json")
+                  .string()) {
+    build_world();
+
+    // The pangenome can only be filled by retiring ants, so load a full one with the world
+    RandomGenerator rng(SEED);
+    Pangenome pangenome;
+    for (size_t i = 0; i < Pangenome::MAX_PANGENOME_SIZE; ++i) {
+      pangenome.add(GenomeBenchmarkBase::make_genome(GENOME_WIDTH, rng, rng.uniform()));
+    }
+    nlohmann::json json = _world->to_json();
+    json["population"]["pangenome"] = pangenome.to_json();
+    _world = std::make_unique<World>(json, _textureCache);
+  }
+
+  ~WorldSerializationBenchmark() { std::filesystem::remove(_path); }
+
+  auto reset() -> void override {}
+
+ protected:
+  std::string _path;
+};
+
+class WorldSaveBenchmark : public WorldSerializationBenchmark {
+ public:
+  using WorldSerializationBenchmark::WorldSerializationBenchmark;
+
+ protected:
+  auto derived_run() -> void override {
+    nlohmann::json save_data;
+    save_data["world"] = _world->to_json();
+    if (!Util::File::write_file(_path, save_data.dump(2))) {
+      FAIL("Could not write " << _path);
+    }
+  }
+};
+
+class WorldLoadBenchmark : public WorldSerializationBenchmark {
+ public:
+  WorldLoadBenchmark(const std::string& name, size_t populationSize)
+      : WorldSerializationBenchmark(name, populationSize) {
+    nlohmann::json save_data;
+    save_data["world"] = _world->to_json();
+    REQUIRE(Util::File::write_file(_path, save_data.dump(2)).has_value());
+  }
+
+ protected:
+  auto derived_run() -> void override {
+    const auto content = Util::File::read_file(_path);
+    if (!content) {
+      FAIL(content.error());
+    }
+    const nlohmann::json save_data = nlohmann::json::parse(*content);
+    *_world = World(save_data.at("world"), _textureCache);
+  }
+};
+
+template <typename BenchmarkType>
+auto run_serialization_benchmark(const std::string& operation, size_t populationSize) -> void {
+  const std::string test_name = "World " + operation + " Benchmark - " +
+                                std::to_string(populationSize) + " ants";
+  const std::string file_name =
+      "world_" + operation + "_" + std::to_string(populationSize) + "_benchmark.md";
+  std::cout << "Running: " << test_name << "\n";
+
+  StatisticalBenchmarkRunner::AdaptivePolicy policy;
+  policy.max_seconds = 10.0;
+  BenchmarkType benchmark(test_name, populationSize);
+  const auto data = StatisticalBenchmarkRunner::run_adaptive_benchmark(benchmark, policy);
+
+  BenchmarkReporter reporter(test_name, file_name);
+  reporter.set_data(data);
+  reporter.generate_report();
+  reporter.write_to_file();
+
+  std::cout << "Completed: " << test_name << " - Report saved to " << file_name << "\n";
+}
+
+TEST_CASE("Statistical World Serialization Benchmarks", "[world][benchmark]") {
+  for (const size_t populationSize : POPULATION_SIZES) {
+    run_serialization_benchmark<WorldSaveBenchmark>("save", populationSize);
+    run_serialization_benchmark<WorldLoadBenchmark>("load", populationSize);
+  }
+}
@@ -65,6 +65,26 @@ TEST_CASE("Ant equality operator", "[ant]") {
     REQUIRE(copy == original);
   }
 
+  SECTION("Copies of INT8 ants get the brain the world now asks for") {
+    Genome genome = create_minimal_genome();
+    genome.randomize();
+    world.set_inference_precision(NeuralNetwork::INT8);
+    Ant original(world, genome);
+    REQUIRE_FALSE(original.get_brain().get_network().has_float_weights());
+
+    // Still INT8: the copy shares the int8 weights without the floats
+    Ant int8Copy(original);
+    REQUIRE_FALSE(int8Copy.get_brain().get_network().has_float_weights());
+    REQUIRE(int8Copy == original);
+
+    // Back to FLOAT: the copy's brain is rebuilt from the genome
+    world.set_inference_precision(NeuralNetwork::FLOAT);
+    Ant floatCopy(original);
+    REQUIRE(floatCopy.get_brain().get_network().get_precision() == NeuralNetwork::FLOAT);
+    REQUIRE(floatCopy.get_brain().get_network().has_float_weights());
+    REQUIRE(floatCopy == original);
+  }
+
   SECTION("Assigned ants are equal") {
     Genome genome = create_minimal_genome();
     genome.randomize();
@@ -91,4 +91,14 @@ TEST_CASE("Ant serialization and deserialization", "[ant][serialization]") {
     // Test genome is serialized
     REQUIRE(json["genome"].is_object());
   }
+
+  SECTION("Deserialized genomes take the world's weight format") {
+    world.set_weight_format(Util::FP32);
+    Genome genome = create_minimal_genome();
+    const auto json = Ant(world, genome).to_json();
+
+    world.set_weight_format(Util::BF16);
+    Ant restored(json, world);
+    REQUIRE(restored.get_genome().get_weight_format() == Util::BF16);
+  }
 }
\ No newline at end of file
@@ -0,0 +1,102 @@
+#include <stdlib.h>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <filesystem>
+#include <numeric>
+#include <vector>
+
+#include "tests/helpers/benchmark_reporter.hpp"
+
+using Catch::Approx;
+
+namespace {
+auto range(double first, size_t count, double scale = 1.0) -> std::vector<double> {
+  std::vector<double> values(count);
+  std::iota(values.begin(), values.end(), first);
+  for (double& value : values) {
+    value *= scale;
+  }
+  return values;
+}
+}  // namespace
+
+TEST_CASE("Benchmark statistics", "[benchmark_reporter]") {
+  SECTION("Median of odd and even sized samples") {
+    REQUIRE(StatisticalBenchmarkRunner::calculate_median({5.0, 1.0, 3.0}) == 3.0);
+    REQUIRE(StatisticalBenchmarkRunner::calculate_median({4.0, 1.0, 3.0, 2.0}) == 2.5);
+    REQUIRE(StatisticalBenchmarkRunner::calculate_median({}) == 0.0);
+  }
+
+  SECTION("Mann-Whitney U matches the normal approximation") {
+    // U = 0, mean 12.5, variance 25 * 11 / 12
+    const double p = StatisticalBenchmarkRunner::mann_whitney_p({1, 2, 3, 4, 5}, {6, 7, 8, 9, 10});
+    REQUIRE(p == Approx(0.01218).margin(1e-4));
+  }
+
+  SECTION("Mann-Whitney U separates shifted samples but not identical ones") {
+    const auto a = range(1.0, 30);
+    REQUIRE(StatisticalBenchmarkRunner::mann_whitney_p(a, a) == Approx(1.0));
+    REQUIRE(StatisticalBenchmarkRunner::mann_whitney_p(a, range(101.0, 30)) < 1e-6);
+    REQUIRE(StatisticalBenchmarkRunner::mann_whitney_p({2, 2, 2}, {2, 2, 2}) == 1.0);
+  }
+
+  SECTION("Bootstrap interval covers the true median ratio") {
+    const auto a = range(1.0, 31);
+    const auto [low, high] =
+        StatisticalBenchmarkRunner::bootstrap_median_ratio(a, range(1.0, 31, 2.0));
+    REQUIRE(low <= 2.0);
+    REQUIRE(high >= 2.0);
+    REQUIRE(low > 1.0);
+
+    // Fixed seed, so the interval is reproducible
+    REQUIRE(StatisticalBenchmarkRunner::bootstrap_median_ratio(a, range(1.0, 31, 2.0)) ==
+            std::pair{low, high});
+  }
+}
+
+TEST_CASE("Benchmark baseline comparison", "[benchmark_reporter]") {
+  const auto directory = std::filesystem::temp_directory_path() / "neural_ants_baseline_test";
+  std::filesystem::remove_all(directory);
+  setenv("BENCHMARK_OUTPUT_DIR", directory.c_str(), 1);
+  unsetenv("BENCHMARK_BASELINE_DIR");
+
+  BenchmarkReporter baseline("Baseline", "comparison_benchmark.md");
+  baseline.set_data(range(1000.0, 30));
+  baseline.generate_report();
+  baseline.write_to_file();
+  REQUIRE(std::filesystem::exists(directory / "comparison_benchmark.md"));
+  REQUIRE(std::filesystem::exists(directory / "comparison_benchmark.json"));
+  REQUIRE(baseline.to_json()["environment"].contains("git_revision"));
+  REQUIRE(baseline.to_json()["statistics"]["median"] == Approx(1014.5));
+
+  setenv("BENCHMARK_BASELINE_DIR", directory.c_str(), 1);
+
+  SECTION("A clearly slower run is a regression") {
+    BenchmarkReporter current("Current", "comparison_benchmark.md");
+    current.set_data(range(1000.0, 30, 1.5));
+    current.generate_report();
+    REQUIRE(current.has_regression());
+    REQUIRE(current.to_json()["comparison"]["status"] == "regression");
+  }
+
+  SECTION("A run within the threshold is unchanged") {
+    BenchmarkReporter current("Current", "comparison_benchmark.md");
+    current.set_data(range(1001.0, 30));
+    current.generate_report();
+    REQUIRE_FALSE(current.has_regression());
+    REQUIRE(current.to_json()["comparison"]["status"] == "unchanged");
+  }
+
+  SECTION("A missing baseline is reported but not a failure") {
+    BenchmarkReporter current("Current", "other_benchmark.md");
+    current.set_data(range(1000.0, 30));
+    current.generate_report();
+    REQUIRE_FALSE(current.has_regression());
+    REQUIRE(current.to_json()["comparison"]["status"] == "missing");
+  }
+
+  unsetenv("BENCHMARK_BASELINE_DIR");
+  unsetenv("BENCHMARK_OUTPUT_DIR");
+  std::filesystem::remove_all(directory);
+}
@@ -0,0 +1,110 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <vector>
+
+#include "tests/helpers/benchmark_reporter.hpp"
+#include "tests/helpers/latency_histogram.hpp"
+
+TEST_CASE("LatencyHistogram buckets", "[benchmark_reporter]") {
+  SECTION("Small values are exact") {
+    for (uint64_t value = 0; value < 2 * LatencyHistogram::SUB_BUCKETS; ++value) {
+      const size_t index = LatencyHistogram::bucket_index(value);
+      REQUIRE(LatencyHistogram::bucket_lower(index) == value);
+      REQUIRE(LatencyHistogram::bucket_upper(index) == value);
+    }
+  }
+
+  SECTION("Every value lands in a bucket that contains it, within the precision") {
+    for (uint64_t value = 1; value < (uint64_t{1} << 62); value = value * 3 + 7) {
+      const size_t index = LatencyHistogram::bucket_index(value);
+      const uint64_t lower = LatencyHistogram::bucket_lower(index);
+      const uint64_t upper = LatencyHistogram::bucket_upper(index);
+      REQUIRE(lower <= value);
+      REQUIRE(value <= upper);
+      REQUIRE(static_cast<double>(upper - lower) <=
+              static_cast<double>(value) / LatencyHistogram::SUB_BUCKETS);
+    }
+    const size_t last = LatencyHistogram::bucket_index(UINT64_MAX);
+    REQUIRE(LatencyHistogram::bucket_upper(last) == UINT64_MAX);
+  }
+
+  SECTION("Buckets are contiguous") {
+    for (size_t index = 1; index < LatencyHistogram::bucket_index(uint64_t{1} << 40); ++index) {
+      REQUIRE(LatencyHistogram::bucket_lower(index) ==
+              LatencyHistogram::bucket_upper(index - 1) + 1);
+    }
+  }
+}
+
+TEST_CASE("LatencyHistogram recording", "[benchmark_reporter]") {
+  LatencyHistogram histogram;
+
+  SECTION("Percentiles of a uniform distribution are within a bucket of exact") {
+    for (uint64_t value = 1; value <= 100000; ++value) {
+      histogram.record(value);
+    }
+    REQUIRE(histogram.count() == 100000);
+    REQUIRE(histogram.min() == 1);
+    REQUIRE(histogram.max() == 100000);
+    for (const double percentile : {50.0, 90.0, 99.0, 99.9}) {
+      const auto expected = static_cast<double>(percentile * 1000.0);
+      const auto actual = static_cast<double>(histogram.percentile(percentile));
+      REQUIRE(actual >= expected);
+      REQUIRE(actual <= expected * (1.0 + 1.0 / LatencyHistogram::SUB_BUCKETS));
+    }
+    REQUIRE(histogram.percentile(100.0) == 100000);
+    REQUIRE(histogram.percentile(0.0) == 1);
+  }
+
+  SECTION("Warm-up samples are discarded") {
+    histogram.set_warm_up(3);
+    for (const uint64_t value : {1000000, 1000000, 1000000, 10, 20}) {
+      histogram.record(value);
+    }
+    REQUIRE(histogram.get_discarded() == 3);
+    REQUIRE(histogram.count() == 2);
+    REQUIRE(histogram.max() == 20);
+  }
+
+  SECTION("Merging and counting above a value") {
+    LatencyHistogram other;
+    histogram.record(100);
+    other.record(5000);
+    other.record(100000);
+    histogram.merge(other);
+    REQUIRE(histogram.count() == 3);
+    REQUIRE(histogram.max() == 100000);
+    REQUIRE(histogram.count_above(1000) == 2);
+    REQUIRE(histogram.count_above(100000) == 0);
+    histogram.reset();
+    REQUIRE(histogram.count() == 0);
+    REQUIRE(histogram.percentile(99.0) == 0);
+  }
+}
+
+TEST_CASE("Benchmark outliers and adaptive sampling", "[benchmark_reporter]") {
+  SECTION("Samples beyond Tukey's fences are annotated") {
+    std::vector<double> data(20, 1000.0);
+    for (size_t i = 0; i < data.size(); ++i) {
+      data[i] += static_cast<double>(i);
+    }
+    data[4] = 1040.0;   // beyond 1.5 IQR
+    data[7] = 5000.0;   // beyond 3 IQR
+    BenchmarkReporter reporter("Outliers", "outliers_benchmark.md");
+    reporter.set_data(data);
+    reporter.generate_report();
+    REQUIRE(reporter.to_json()["outliers"]["mild"] == std::vector<size_t>{4});
+    REQUIRE(reporter.to_json()["outliers"]["severe"] == std::vector<size_t>{7});
+  }
+
+  SECTION("Relative confidence interval shrinks with more samples") {
+    const std::vector<double> few = {90.0, 110.0, 95.0, 105.0};
+    std::vector<double> many;
+    for (int i = 0; i < 25; ++i) {
+      many.insert(many.end(), few.begin(), few.end());
+    }
+    REQUIRE(StatisticalBenchmarkRunner::relative_ci(many) <
+            StatisticalBenchmarkRunner::relative_ci(few));
+    REQUIRE(StatisticalBenchmarkRunner::calculate_percentile({1.0, 2.0, 3.0, 4.0}, 50.0) == 2.5);
+  }
+}
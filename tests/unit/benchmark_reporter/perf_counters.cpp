@@ -0,0 +1,105 @@
+#include <catch2/catch_test_macros.hpp>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "tests/helpers/benchmark_reporter.hpp"
+#include "tests/helpers/perf_counters.hpp"
+
+namespace {
+auto sample(uint64_t cycles, uint64_t instructions) -> PerfCounters::Sample {
+  PerfCounters::Sample counted;
+  counted.values[PerfCounters::CYCLES] = cycles;
+  counted.values[PerfCounters::INSTRUCTIONS] = instructions;
+  counted.valid[PerfCounters::CYCLES] = true;
+  counted.valid[PerfCounters::INSTRUCTIONS] = true;
+  return counted;
+}
+}  // namespace
+
+TEST_CASE("Hardware performance counters", "[benchmark_reporter]") {
+  SECTION("Samples add up the events counted in both") {
+    PerfCounters::Sample total;
+    REQUIRE(total.empty());
+
+    total += sample(100, 200);
+    total += sample(50, 25);
+    REQUIRE(total.values[PerfCounters::CYCLES] == 150);
+    REQUIRE(total.values[PerfCounters::INSTRUCTIONS] == 225);
+    REQUIRE_FALSE(total.valid[PerfCounters::LLC_MISSES]);
+
+    PerfCounters::Sample cycles_only = sample(10, 0);
+    cycles_only.valid[PerfCounters::INSTRUCTIONS] = false;
+    total += cycles_only;
+    REQUIRE(total.valid[PerfCounters::CYCLES]);
+    REQUIRE_FALSE(total.valid[PerfCounters::INSTRUCTIONS]);
+  }
+
+  SECTION("Counting either works or explains why not") {
+    PerfCounters counters;
+    if (!counters.is_available()) {
+      REQUIRE_FALSE(counters.get_error().empty());
+      counters.start();
+      REQUIRE(counters.stop().empty());
+      return;
+    }
+
+    std::vector<double> values(100000, 1.5);
+    counters.start();
+    const double sum = std::accumulate(values.begin(), values.end(), 0.0);
+    const PerfCounters::Sample counted = counters.stop();
+    REQUIRE(sum == 150000.0);
+    if (counted.valid[PerfCounters::INSTRUCTIONS]) {
+      REQUIRE(counted.values[PerfCounters::INSTRUCTIONS] >= values.size());
+    }
+  }
+
+  SECTION("Reports give per-unit counts or the reason they are missing") {
+    BenchmarkReporter reporter("Counters", "counters_benchmark.md");
+    reporter.set_data({1.0, 2.0, 3.0});
+
+    BenchmarkReporter::CounterReport report{.work_per_iteration = 10.0, .work_unit = "ant"};
+    report.samples = {sample(1000, 3000), sample(3000, 5000)};
+    reporter.set_counters(report);
+    reporter.generate_report();
+    const auto& json = reporter.to_json()["counters"];
+    REQUIRE(json["available"] == true);
+    REQUIRE(json["per_iteration"]["cycles"] == 2000.0);
+    REQUIRE(json["per_iteration"]["instructions"] == 4000.0);
+    REQUIRE_FALSE(json["per_iteration"].contains("branch misses"));
+
+    reporter.set_counters({.error = "perf_event_open failed for cycles: Permission denied"});
+    reporter.generate_report();
+    REQUIRE(reporter.to_json()["counters"]["available"] == false);
+    REQUIRE(reporter.to_json()["counters"]["error"] ==
+            "perf_event_open failed for cycles: Permission denied");
+  }
+
+  SECTION("Allocation reports give totals and per-iteration counts for each phase") {
+    BenchmarkReporter reporter("Allocations", "allocations_benchmark.md");
+    reporter.set_data({1.0, 2.0, 3.0});
+    BenchmarkReporter::AllocationReport allocations{.iterations = 4, .iteration_unit = "tick"};
+    allocations.phases = {{"think", {0, 0}}, {"retire/breed", {8, 1024}}};
+    reporter.set_allocations(allocations);
+    reporter.generate_report();
+
+    const auto& json = reporter.to_json()["allocations"];
+    REQUIRE(json["iterations"] == 4);
+    REQUIRE(json["phases"]["think"]["allocations"] == 0);
+    REQUIRE(json["phases"]["retire/breed"]["allocations_per_iteration"] == 2.0);
+    REQUIRE(json["phases"]["retire/breed"]["bytes_per_iteration"] == 256.0);
+  }
+
+  SECTION("Memory reports give per-object costs for the parts that have objects") {
+    BenchmarkReporter reporter("Memory", "memory_benchmark.md");
+    reporter.set_data({1.0, 2.0, 3.0});
+    reporter.set_memory({.parts = {{"ants", {4096, 8}, 4, "ant"}, {"world", {8192, 20}}}});
+    reporter.generate_report();
+
+    const auto& json = reporter.to_json()["memory"]["parts"];
+    REQUIRE(json["ants"]["bytes_per_object"] == 1024.0);
+    REQUIRE(json["ants"]["allocations_per_object"] == 2.0);
+    REQUIRE(json["world"]["bytes"] == 8192);
+    REQUIRE_FALSE(json["world"].contains("bytes_per_object"));
+  }
+}
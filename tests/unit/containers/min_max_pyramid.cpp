@@ -0,0 +1,123 @@
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <vector>
+
+#include "containers/min_max_pyramid.hpp"
+
+namespace {
+// Points should tile [first, end) with no gaps or overlaps
+template <typename Points>
+auto contiguous(const Points& points, double first, double end) -> bool {
+  double next = first;
+  for (const auto& point : points) {
+    if (point.first != next) {
+      return false;
+    }
+    next = point.first + point.count;
+  }
+  return next == end;
+}
+}  // namespace
+
+TEST_CASE("MinMaxPyramid", "[min_max_pyramid]") {
+  typedef Containers::MinMaxPyramid<double> Pyramid;
+  std::vector<Pyramid::Point> points;
+
+  SECTION("Short histories are returned sample by sample") {
+    Pyramid pyramid;
+    REQUIRE(pyramid.empty());
+    for (int i = 0; i < 10; ++i) {
+      pyramid.push(static_cast<double>(i));
+    }
+    pyramid.sample(0, 10, 100, points);
+    REQUIRE(points.size() == 10);
+    REQUIRE(points[3].min == 3.0);
+    REQUIRE(points[3].max == 3.0);
+    REQUIRE(points[3].mean == 3.0);
+    REQUIRE(contiguous(points, 0.0, 10.0));
+  }
+
+  SECTION("Long histories are summarized without losing their extremes") {
+    Pyramid pyramid;
+    const uint64_t samples = 100000;
+    for (uint64_t i = 0; i < samples; ++i) {
+      pyramid.push(i == 4321 ? -50.0 : static_cast<double>(i % 100));
+    }
+    pyramid.sample(0, samples, 200, points);
+    REQUIRE(points.size() <= 200 + 32);
+    REQUIRE(contiguous(points, 0.0, static_cast<double>(samples)));
+
+    double lowest = 0.0;
+    double highest = 0.0;
+    double total = 0.0;
+    for (const auto& point : points) {
+      lowest = std::min(lowest, point.min);
+      highest = std::max(highest, point.max);
+      total += point.mean * point.count;
+    }
+    REQUIRE(lowest == -50.0);
+    REQUIRE(highest == 99.0);
+    // Every sample is counted exactly once
+    const double expected = 1000.0 * 4950.0 - static_cast<double>(4321 % 100) - 50.0;
+    REQUIRE(total == Catch::Approx(expected));
+  }
+
+  SECTION("Zooming in reads finer levels") {
+    Pyramid pyramid;
+    for (int i = 0; i < 100000; ++i) {
+      pyramid.push(static_cast<double>(i));
+    }
+    pyramid.sample(99900, 99950, 100, points);
+    REQUIRE(points.size() == 50);
+    REQUIRE(points.front().first == 99900.0);
+    REQUIRE(points.front().count == 1.0);
+
+    pyramid.sample(50000, 50400, 100, points);
+    REQUIRE(points.size() <= 101);
+    REQUIRE(points.front().first <= 50000.0);
+    REQUIRE(points.back().first + points.back().count >= 50400.0);
+  }
+
+  SECTION("Memory stays bounded and old history coarsens") {
+    Containers::MinMaxPyramid<float, 4, 3> small;
+    for (int i = 0; i < 100; ++i) {
+      small.push(static_cast<float>(i));
+    }
+    const size_t bytes = small.memory_usage().bytes;
+    for (int i = 100; i < 10000; ++i) {
+      small.push(static_cast<float>(i));
+    }
+    REQUIRE(small.memory_usage().bytes == bytes);
+    REQUIRE(small.get_oldest(0) == 9996);
+    REQUIRE(small.get_oldest(2) == 9984);
+
+    // The coarsest level covers what it still holds; older samples are gone
+    std::vector<Containers::MinMaxPyramid<float, 4, 3>::Point> coarse;
+    small.sample(0, 10000, 8, coarse);
+    REQUIRE(coarse.front().first == 9984.0);
+    REQUIRE(contiguous(coarse, 9984.0, 10000.0));
+    REQUIRE(coarse.back().max == 9999.0);
+  }
+
+  SECTION("Newest samples are included before their coarse bucket completes") {
+    Containers::MinMaxPyramid<double, 4, 4> pyramid;
+    for (int i = 0; i < 45; ++i) {
+      pyramid.push(static_cast<double>(i));
+    }
+    std::vector<Containers::MinMaxPyramid<double, 4, 4>::Point> points;
+    pyramid.sample(0, 45, 4, points);
+    // The four buckets of 8 still held cover 8..40, then a bucket of 4 and one sample
+    REQUIRE(contiguous(points, 8.0, 45.0));
+    REQUIRE(points.back().first == 44.0);
+    REQUIRE(points.back().count == 1.0);
+  }
+
+  SECTION("Clearing starts a new history") {
+    Pyramid pyramid;
+    pyramid.push(1.0);
+    pyramid.clear();
+    REQUIRE(pyramid.empty());
+    pyramid.sample(0, 10, 10, points);
+    REQUIRE(points.empty());
+  }
+}
@@ -0,0 +1,106 @@
+#include <raylib.h>
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <vector>
+
+#include "containers/spatial_grid.hpp"
+
+namespace {
+auto collect(const Containers::SpatialGrid& grid, const Rectangle& rect) -> std::vector<size_t> {
+  std::vector<size_t> found;
+  grid.query(rect, [&](size_t index) { found.push_back(index); });
+  std::sort(found.begin(), found.end());
+  return found;
+}
+}  // namespace
+
+TEST_CASE("SpatialGrid query", "[spatial_grid]") {
+  const Rectangle bounds = {0.0f, 0.0f, 1000.0f, 1000.0f};
+  Containers::SpatialGrid grid(bounds, 100.0f);
+
+  SECTION("Empty grid visits nothing") {
+    REQUIRE(grid.empty());
+    REQUIRE(collect(grid, bounds).empty());
+  }
+
+  SECTION("Query returns only items in overlapping cells") {
+    std::vector<Vector2> positions = {{50.0f, 50.0f}, {950.0f, 950.0f}, {150.0f, 50.0f}};
+    grid.build(positions.size(), [&](size_t index) { return positions[index]; });
+
+    REQUIRE(grid.size() == 3);
+    REQUIRE(collect(grid, {0.0f, 0.0f, 90.0f, 90.0f}) == std::vector<size_t>{0});
+    REQUIRE(collect(grid, {0.0f, 0.0f, 190.0f, 90.0f}) == std::vector<size_t>{0, 2});
+    REQUIRE(collect(grid, {900.0f, 900.0f, 50.0f, 50.0f}) == std::vector<size_t>{1});
+    REQUIRE(collect(grid, bounds) == std::vector<size_t>{0, 1, 2});
+  }
+
+  SECTION("Items outside the bounds are clamped to edge cells") {
+    std::vector<Vector2> positions = {{-500.0f, -500.0f}, {5000.0f, 5000.0f}};
+    grid.build(positions.size(), [&](size_t index) { return positions[index]; });
+
+    REQUIRE(collect(grid, {0.0f, 0.0f, 10.0f, 10.0f}) == std::vector<size_t>{0});
+    REQUIRE(collect(grid, {990.0f, 990.0f, 10.0f, 10.0f}) == std::vector<size_t>{1});
+  }
+
+  SECTION("Query rectangles beyond the bounds are clamped") {
+    std::vector<Vector2> positions = {{500.0f, 500.0f}};
+    grid.build(positions.size(), [&](size_t index) { return positions[index]; });
+
+    REQUIRE(collect(grid, {-1000.0f, -1000.0f, 3000.0f, 3000.0f}) == std::vector<size_t>{0});
+    REQUIRE(collect(grid, {-1000.0f, -1000.0f, 10.0f, 10.0f}).empty());
+  }
+
+  SECTION("Rebuilding replaces previous contents") {
+    std::vector<Vector2> positions = {{50.0f, 50.0f}, {60.0f, 60.0f}};
+    grid.build(positions.size(), [&](size_t index) { return positions[index]; });
+    REQUIRE(collect(grid, {0.0f, 0.0f, 90.0f, 90.0f}).size() == 2);
+
+    positions = {{550.0f, 550.0f}};
+    grid.build(positions.size(), [&](size_t index) { return positions[index]; });
+    REQUIRE(grid.size() == 1);
+    REQUIRE(collect(grid, {0.0f, 0.0f, 90.0f, 90.0f}).empty());
+    REQUIRE(collect(grid, {500.0f, 500.0f, 90.0f, 90.0f}) == std::vector<size_t>{0});
+  }
+
+  SECTION("Every item is visited exactly once by a covering query") {
+    std::vector<Vector2> positions;
+    for (int i = 0; i < 500; ++i) {
+      positions.push_back({static_cast<float>((i * 37) % 1000), static_cast<float>((i * 91) % 1000)});
+    }
+    grid.build(positions.size(), [&](size_t index) { return positions[index]; });
+
+    auto found = collect(grid, bounds);
+    REQUIRE(found.size() == positions.size());
+    for (size_t i = 0; i < found.size(); ++i) {
+      REQUIRE(found[i] == i);
+    }
+  }
+
+  SECTION("A visitor returning false stops the query") {
+    std::vector<Vector2> positions = {{50.0f, 50.0f}, {150.0f, 50.0f}, {550.0f, 550.0f}};
+    grid.build(positions.size(), [&](size_t index) { return positions[index]; });
+
+    size_t visited = 0;
+    grid.query(bounds, [&](size_t) { return ++visited < 2; });
+    REQUIRE(visited == 2);
+  }
+
+  SECTION("Cell queries partition the items") {
+    std::vector<Vector2> positions;
+    for (int i = 0; i < 200; ++i) {
+      positions.push_back({static_cast<float>((i * 53) % 1000), static_cast<float>((i * 17) % 1000)});
+    }
+    grid.build(positions.size(), [&](size_t index) { return positions[index]; });
+
+    std::vector<size_t> found;
+    for (size_t cell = 0; cell < grid.get_cell_count(); ++cell) {
+      grid.query_cell(cell, [&](size_t index) { found.push_back(index); });
+    }
+    std::sort(found.begin(), found.end());
+    REQUIRE(found.size() == positions.size());
+    for (size_t i = 0; i < found.size(); ++i) {
+      REQUIRE(found[i] == i);
+    }
+  }
+}
@@ -0,0 +1,58 @@
+#include <catch2/catch_test_macros.hpp>
+#include <thread>
+#include <vector>
+
+#include "containers/spsc_ring.hpp"
+
+TEST_CASE("SpscRing", "[spsc_ring]") {
+  SECTION("Items come out in the order they went in") {
+    Containers::SpscRing<int, 4> ring;
+    REQUIRE(ring.empty());
+    REQUIRE(ring.push(1));
+    REQUIRE(ring.push(2));
+    REQUIRE(ring.size() == 2);
+    REQUIRE(ring.pop() == 1);
+    REQUIRE(ring.pop() == 2);
+    REQUIRE_FALSE(ring.pop().has_value());
+  }
+
+  SECTION("A full ring drops new items instead of waiting") {
+    Containers::SpscRing<int, 4> ring;
+    for (int i = 0; i < 4; ++i) {
+      REQUIRE(ring.push(i));
+    }
+    REQUIRE_FALSE(ring.push(4));
+    REQUIRE(ring.get_dropped() == 1);
+
+    // Wrapping around reuses the freed slots
+    REQUIRE(ring.pop() == 0);
+    REQUIRE(ring.push(5));
+    std::vector<int> drained;
+    REQUIRE(ring.drain([&](int item) { drained.push_back(item); }) == 4);
+    REQUIRE(drained == std::vector<int>{1, 2, 3, 5});
+  }
+
+  SECTION("A consumer thread sees every item a producer thread pushed") {
+    constexpr int COUNT = 100000;
+    Containers::SpscRing<int, 64> ring;
+    std::thread producer([&] {
+      for (int i = 0; i < COUNT; ++i) {
+        while (!ring.push(i)) {
+          std::this_thread::yield();
+        }
+      }
+    });
+
+    int expected = 0;
+    bool ordered = true;
+    while (expected < COUNT) {
+      if (auto item = ring.pop()) {
+        ordered = ordered && *item == expected;
+        ++expected;
+      }
+    }
+    producer.join();
+    REQUIRE(ordered);
+    REQUIRE(ring.empty());
+  }
+}
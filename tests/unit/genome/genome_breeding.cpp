@@ -0,0 +1,76 @@
+#include <catch2/catch_test_macros.hpp>
+#include <vector>
+
+#include "genome.hpp"
+#include "neural_network.hpp"
+
+namespace {
+auto parameters(const Genome& genome) -> std::vector<Neuron::Value> {
+  std::vector<Neuron::Value> values(genome.get_network().get_parameter_count());
+  genome.get_network().get_parameters(values);
+  return values;
+}
+
+auto changed_fraction(const std::vector<Neuron::Value>& a, const std::vector<Neuron::Value>& b)
+    -> double {
+  size_t changed = 0;
+  for (size_t i = 0; i < a.size(); ++i) {
+    changed += a[i] != b[i] ? 1 : 0;
+  }
+  return static_cast<double>(changed) / static_cast<double>(a.size());
+}
+}  // namespace
+
+TEST_CASE("Genome breeding", "[genome][breeding]") {
+  Genome parentA;
+  Genome parentB;
+  RandomGenerator rng(36);
+  parentA.randomize();
+  parentB.randomize();
+
+  SECTION("Crossover takes every parameter from one of the parents") {
+    parentA.set_mutation_rate(0.0);
+    parentB.set_mutation_rate(0.0);
+    const auto a = parameters(parentA);
+    const auto b = parameters(parentB);
+
+    const auto child = parameters(parentA.breed_with(parentB, rng));
+    size_t fromA = 0;
+    for (size_t i = 0; i < child.size(); ++i) {
+      REQUIRE((child[i] == a[i] || child[i] == b[i]));
+      fromA += child[i] == a[i] ? 1 : 0;
+    }
+    // About half of the ~3.6k parameters come from each parent
+    const double share = static_cast<double>(fromA) / static_cast<double>(child.size());
+    REQUIRE(share > 0.45);
+    REQUIRE(share < 0.55);
+  }
+
+  SECTION("Breeding draws from the caller's generator, not the parents") {
+    RandomGenerator first(7);
+    RandomGenerator second(7);
+    const Genome& parent = parentA;
+    const auto child = parameters(parent.breed_with(parentB, first));
+    REQUIRE(parameters(parent.breed_with(parentB, second)) == child);
+    REQUIRE(parameters(parent.breed_with(parentB, first)) != child);
+  }
+
+  SECTION("Mutation touches about rate x N parameters") {
+    const auto before = parameters(parentA);
+
+    parentA.set_mutation_rate(0.0);
+    parentA.mutate();
+    REQUIRE(parameters(parentA) == before);
+
+    parentA.set_mutation_rate(0.1);
+    parentA.mutate();
+    const double fraction = changed_fraction(before, parameters(parentA));
+    REQUIRE(fraction > 0.08);
+    REQUIRE(fraction < 0.12);
+
+    const auto partlyMutated = parameters(parentA);
+    parentA.set_mutation_rate(1.0);
+    parentA.mutate();
+    REQUIRE(changed_fraction(partlyMutated, parameters(parentA)) > 0.99);
+  }
+}
@@ -0,0 +1,129 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include "genome.hpp"
+#include "neural_network.hpp"
+#include "pangenome.hpp"
+
+namespace {
+auto parameters(const NeuralNetwork& network) -> std::vector<Neuron::Value> {
+  std::vector<Neuron::Value> values(network.get_parameter_count());
+  network.get_parameters(values);
+  return values;
+}
+
+auto max_difference(const std::vector<Neuron::Value>& a, const std::vector<Neuron::Value>& b)
+    -> float {
+  float difference = 0.0F;
+  for (size_t i = 0; i < a.size(); ++i) {
+    difference = std::max(difference, std::abs(a[i] - b[i]));
+  }
+  return difference;
+}
+}  // namespace
+
+TEST_CASE("Genome compact weight storage", "[genome][half]") {
+  Genome genome;
+  genome.randomize();
+  genome.set_fitness(3.5);
+  const auto original = parameters(genome.get_network());
+
+  SECTION("Parameters round trip through the flat layout") {
+    NeuralNetwork copy = genome.get_network();
+    auto values = original;
+    values[0] += 1.0F;
+    copy.set_parameters(values);
+    REQUIRE(parameters(copy) == values);
+    REQUIRE(copy.get_hidden_layer(0)[0].get_bias() == values[0]);
+    REQUIRE_THROWS_AS(copy.set_parameters(std::vector<Neuron::Value>(3)), std::invalid_argument);
+  }
+
+  SECTION("Compacting halves the weight bytes and releases the float layers") {
+    const size_t floatBytes = genome.get_weight_bytes();
+    REQUIRE(floatBytes == original.size() * sizeof(float));
+
+    genome.compact(Util::FP16);
+    REQUIRE(genome.is_compact());
+    REQUIRE(genome.get_weight_bytes() * 2 == floatBytes);
+    REQUIRE_THROWS_AS(genome.get_network(), std::logic_error);
+    REQUIRE(genome.get_fitness() == 3.5);
+  }
+
+  SECTION("Expanding restores the weights within the format's precision") {
+    for (auto [format, tolerance] : {std::pair{Util::FP16, 2.0e-3F}, {Util::BF16, 1.6e-2F}}) {
+      Genome copy = genome;
+      copy.compact(format);
+      REQUIRE(max_difference(parameters(copy.to_network()), original) <= tolerance);
+      copy.expand();
+      REQUIRE_FALSE(copy.is_compact());
+      REQUIRE(max_difference(parameters(copy.get_network()), original) <= tolerance);
+      REQUIRE(copy.get_network().get_input_count() == genome.get_network().get_input_count());
+    }
+  }
+
+  SECTION("Compact genomes serialize packed weights") {
+    const size_t floatSize = genome.to_json().dump().size();
+    genome.compact(Util::BF16);
+    const auto json = genome.to_json();
+    REQUIRE(json.contains("packed_network"));
+    REQUIRE_FALSE(json.contains("network"));
+    REQUIRE(json.dump().size() * 2 < floatSize);
+
+    Genome restored(json);
+    REQUIRE(restored == genome);
+    REQUIRE(restored.get_weight_format() == Util::BF16);
+  }
+
+  SECTION("Breeding expands compact parents into the child only") {
+    Genome other = genome;
+    genome.compact(Util::FP16);
+    other.compact(Util::BF16);
+    const Genome& parent = genome;
+    RandomGenerator rng(35);
+    Genome child = parent.breed_with(other, rng);
+    REQUIRE_FALSE(child.is_compact());
+    REQUIRE(genome.get_weight_format() == Util::FP16);
+    REQUIRE(other.get_weight_format() == Util::BF16);
+    REQUIRE(child.get_network().get_parameter_count() == original.size());
+  }
+
+  SECTION("Children of a compact parent take its widened weights") {
+    Genome other;
+    other.randomize();
+    genome.set_mutation_rate(0.0);
+    other.set_mutation_rate(0.0);
+    genome.compact(Util::FP16);
+    const auto fromCompact = parameters(genome.to_network());
+    const auto fromOther = parameters(other.get_network());
+
+    RandomGenerator rng(35);
+    const auto child = parameters(genome.breed_with(other, rng).get_network());
+    size_t taken = 0;
+    for (size_t i = 0; i < child.size(); ++i) {
+      REQUIRE((child[i] == fromCompact[i] || child[i] == fromOther[i]));
+      taken += child[i] == fromCompact[i] ? 1 : 0;
+    }
+    REQUIRE(taken > child.size() / 3);
+  }
+
+  SECTION("Pangenome stores compact genomes and samples expanded ones") {
+    Pangenome pangenome;
+    pangenome.set_weight_format(Util::FP16);
+    for (int i = 0; i < 4; ++i) {
+      Genome member = genome;
+      member.set_fitness(i);
+      pangenome.add(std::move(member));
+    }
+    REQUIRE(pangenome.get_weight_bytes() == 4 * original.size() * sizeof(Util::Half));
+    REQUIRE_FALSE(pangenome.sample_random().is_compact());
+
+    pangenome.set_weight_format(Util::FP32);
+    REQUIRE(pangenome.get_weight_bytes() == 4 * original.size() * sizeof(float));
+
+    pangenome.set_weight_format(Util::BF16);
+    Pangenome restored(pangenome.to_json());
+    REQUIRE(restored == pangenome);
+  }
+}
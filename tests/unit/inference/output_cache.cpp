@@ -0,0 +1,69 @@
+#include <catch2/catch_test_macros.hpp>
+#include <vector>
+
+#include "inference/output_cache.hpp"
+#include "neural_network.hpp"
+
+using Inference::OutputCache;
+
+TEST_CASE("OutputCache lookups", "[inference][output_cache]") {
+  OutputCache cache;
+  const std::vector<OutputCache::Mask> empty = {0, 0};
+  const std::vector<OutputCache::Mask> food = {0b100, 0};
+  const std::vector<Neuron::Value> outputs = {0.25f, -0.5f};
+
+  SECTION("Empty cache misses") {
+    REQUIRE(cache.find(empty, empty).empty());
+    REQUIRE(cache.get_stats().misses == 1);
+    REQUIRE(cache.get_stats().hits == 0);
+  }
+
+  SECTION("Inserted patterns hit with their outputs") {
+    cache.insert(food, empty, outputs);
+    const auto found = cache.find(food, empty);
+    REQUIRE(std::vector<Neuron::Value>(found.begin(), found.end()) == outputs);
+
+    // Same bits as walls instead of food is a different pattern
+    REQUIRE(cache.find(empty, food).empty());
+    REQUIRE(cache.get_stats().hits == 1);
+    REQUIRE(cache.get_stats().misses == 1);
+    REQUIRE(cache.get_stats().hit_rate() == 0.5);
+  }
+
+  SECTION("Clear drops entries but keeps the counters") {
+    cache.insert(food, empty, outputs);
+    REQUIRE_FALSE(cache.find(food, empty).empty());
+    cache.clear();
+    REQUIRE(cache.find(food, empty).empty());
+    REQUIRE(cache.get_stats().lookups() == 2);
+  }
+}
+
+TEST_CASE("NeuralNetwork output cache", "[inference][output_cache]") {
+  NeuralNetwork network;
+  network.randomize();
+
+  const std::vector<OutputCache::Mask> none = {0, 0};
+  const std::vector<OutputCache::Mask> food = {0b1010, 0};
+
+  network.set_input_masks(none, none);
+  const auto emptyOutputs = network.get_output_values();
+  const std::vector<Neuron::Value> expected(emptyOutputs.begin(), emptyOutputs.end());
+
+  network.set_input_masks(food, none);
+  network.get_output_values();
+  REQUIRE(network.get_output_cache_stats().hits == 0);
+
+  // Seeing the empty window again is answered from the cache with identical outputs
+  network.set_input_masks(none, none);
+  const auto cachedOutputs = network.get_output_values();
+  REQUIRE(network.get_output_cache_stats().hits == 1);
+  REQUIRE(std::vector<Neuron::Value>(cachedOutputs.begin(), cachedOutputs.end()) == expected);
+
+  // New weights invalidate every cached output
+  network.randomize();
+  network.set_input_masks(food, none);
+  network.set_input_masks(none, none);
+  network.get_output_values();
+  REQUIRE(network.get_output_cache_stats().hits == 1);
+}
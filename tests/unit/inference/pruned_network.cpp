@@ -0,0 +1,170 @@
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include "inference/pruned_network.hpp"
+#include "inference/ternary_layer.hpp"
+#include "neural_network.hpp"
+#include "neuron.hpp"
+#include "random_generator.hpp"
+
+using Catch::Approx;
+using Inference::BlockSparseLayer;
+using Inference::PrunedNetwork;
+using Inference::TernaryLayer;
+
+namespace {
+auto random_layer(RandomGenerator& rng, size_t neurons, size_t inputs) -> std::vector<Neuron> {
+  std::vector<Neuron> layer(neurons);
+  for (Neuron& neuron : layer) {
+    neuron.set_input_count(inputs);
+    neuron.randomize(rng);
+  }
+  return layer;
+}
+
+auto random_ternary(RandomGenerator& rng, size_t count) -> std::vector<Neuron::Value> {
+  std::vector<Neuron::Value> values(count);
+  for (auto& value : values) {
+    value = static_cast<Neuron::Value>(rng.uniform_int(-1, 1));
+  }
+  return values;
+}
+
+auto indices(size_t count) -> std::vector<uint32_t> {
+  std::vector<uint32_t> all(count);
+  std::iota(all.begin(), all.end(), 0U);
+  return all;
+}
+
+// bias + inputs . weights of neuron over the weights at or above threshold
+auto pruned_sum(const Neuron& neuron, const std::vector<Neuron::Value>& inputs, float threshold)
+    -> Neuron::Value {
+  Neuron::Value sum = neuron.get_bias();
+  for (size_t input = 0; input < inputs.size(); ++input) {
+    sum += inputs[input] * Neuron::prune(neuron.get_input_weight(input), threshold);
+  }
+  return sum;
+}
+}  // namespace
+
+TEST_CASE("BlockSparseLayer keeps only the weights above the threshold",
+          "[inference][pruned_network]") {
+  RandomGenerator rng(5);
+  // More neurons than one block and more inputs than one mask word
+  const size_t neuronCount = BlockSparseLayer::BLOCK_SIZE * 2 + 5;
+  const size_t inputCount = 70;
+  const float threshold = 1.5F;
+  auto layer = random_layer(rng, neuronCount, inputCount);
+  // Input 3 has nothing left after pruning, so it gets no column
+  for (Neuron& neuron : layer) {
+    neuron.set_input_weight(3, 0.1F);
+  }
+  BlockSparseLayer sparse;
+  sparse.build(layer, indices(neuronCount), indices(inputCount), threshold);
+
+  SECTION("Ternary masks, values and single columns match the pruned dot products") {
+    const auto inputs = random_ternary(rng, inputCount);
+    std::vector<TernaryLayer::Mask> positive(TernaryLayer::mask_count(inputCount));
+    std::vector<TernaryLayer::Mask> negative(positive.size());
+    REQUIRE(TernaryLayer::pack(inputs, positive, negative));
+
+    std::vector<Neuron::Value> fromMasks(neuronCount);
+    std::vector<Neuron::Value> fromValues(neuronCount);
+    sparse.pre_activate(positive, negative, fromMasks);
+    sparse.pre_activate(inputs, fromValues);
+    for (size_t neuron = 0; neuron < neuronCount; ++neuron) {
+      const Neuron::Value expected = pruned_sum(layer[neuron], inputs, threshold);
+      REQUIRE(fromMasks[neuron] == Approx(expected).margin(1e-4));
+      REQUIRE(fromValues[neuron] == Approx(expected).margin(1e-4));
+    }
+
+    auto changed = inputs;
+    changed[10] += 0.5F;
+    sparse.add_column(10, 0.5F, fromValues);
+    sparse.add_column(3, 1.0F, fromValues);
+    for (size_t neuron = 0; neuron < neuronCount; ++neuron) {
+      REQUIRE(fromValues[neuron] ==
+              Approx(pruned_sum(layer[neuron], changed, threshold)).margin(1e-4));
+    }
+  }
+
+  SECTION("Only kept weights are stored") {
+    size_t kept = 0;
+    for (const Neuron& neuron : layer) {
+      for (const Neuron::Value weight : neuron.get_weights()) {
+        kept += Neuron::prune(weight, threshold) != 0.0F ? 1 : 0;
+      }
+    }
+    REQUIRE(sparse.get_weight_count() == kept);
+
+    TernaryLayer dense;
+    dense.build(layer, inputCount);
+    REQUIRE(sparse.memory_usage().bytes < dense.memory_usage().bytes);
+  }
+
+  SECTION("A subset of neurons reads a subset of inputs in the given order") {
+    const std::vector<uint32_t> neurons{4, 20, 33};
+    const std::vector<uint32_t> columns{7, 2, 65};
+    BlockSparseLayer subset;
+    subset.build(layer, neurons, columns, threshold);
+    REQUIRE(subset.get_input_count() == 3);
+    REQUIRE(subset.get_neuron_count() == 3);
+
+    const std::vector<Neuron::Value> inputs{0.5F, -1.0F, 0.25F};
+    std::vector<Neuron::Value> out(3);
+    subset.pre_activate(inputs, out);
+    for (size_t row = 0; row < neurons.size(); ++row) {
+      const Neuron& neuron = layer[neurons[row]];
+      Neuron::Value expected = neuron.get_bias();
+      for (size_t input = 0; input < columns.size(); ++input) {
+        const Neuron::Value weight = neuron.get_input_weight(columns[input]);
+        expected += inputs[input] * Neuron::prune(weight, threshold);
+      }
+      REQUIRE(out[row] == Approx(expected).margin(1e-4));
+    }
+  }
+
+  SECTION("Rejects buffers of the wrong size") {
+    std::vector<Neuron::Value> out(neuronCount - 1);
+    REQUIRE_THROWS_AS(sparse.pre_activate(std::vector<Neuron::Value>(inputCount), out),
+                      std::invalid_argument);
+    REQUIRE_THROWS_AS(sparse.add_column(inputCount, 1.0F, out), std::invalid_argument);
+  }
+}
+
+TEST_CASE("PrunedNetwork drops neurons that cannot reach the outputs",
+          "[inference][pruned_network]") {
+  NeuralNetwork network;
+  network.randomize();
+  // Nothing in the second hidden layer keeps a weight from first-layer neuron 5, so neither it
+  // nor its input weights are needed
+  network.edit_neurons([](size_t layerIndex, size_t, Neuron& neuron) {
+    if (layerIndex == 1) {
+      neuron.set_input_weight(5, 0.1F);
+    }
+  });
+
+  PrunedNetwork pruned;
+  std::vector<std::vector<Neuron>> hidden;
+  for (size_t layer = 0; layer < network.get_hidden_layer_count(); ++layer) {
+    hidden.push_back(network.get_hidden_layer(layer));
+  }
+  pruned.load(network.get_input_count(), hidden, network.get_output_layer(), 0.5F);
+  REQUIRE(pruned.get_first_layer().get_neuron_count() ==
+          network.get_hidden_layer_neuron_count() - 1);
+
+  // A threshold above every weight leaves the outputs with their biases alone
+  pruned.load(network.get_input_count(), hidden, network.get_output_layer(), 10.0F);
+  REQUIRE(pruned.get_first_layer().get_neuron_count() == 0);
+  REQUIRE(pruned.get_weight_count() == 0);
+  std::vector<Neuron::Value> outputs(network.get_output_neuron_count());
+  pruned.propagate({}, outputs);
+  for (size_t output = 0; output < outputs.size(); ++output) {
+    REQUIRE(outputs[output] ==
+            Approx(Neuron::activation_function(network.get_output_layer()[output].get_bias())));
+  }
+}
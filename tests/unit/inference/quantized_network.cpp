@@ -0,0 +1,218 @@
+#include <algorithm>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include "inference/quantized_network.hpp"
+#include "neural_network.hpp"
+#include "random_generator.hpp"
+
+using Catch::Approx;
+using Inference::QuantizedLayer;
+using Inference::QuantizedTernaryLayer;
+using Inference::TernaryLayer;
+
+namespace {
+auto random_inputs(RandomGenerator& rng, size_t count) -> std::vector<Neuron::Value> {
+  std::vector<Neuron::Value> inputs(count);
+  for (auto& input : inputs) {
+    input = static_cast<Neuron::Value>(rng.uniform(-1.0, 1.0));
+  }
+  return inputs;
+}
+
+auto random_ternary(RandomGenerator& rng, size_t count) -> std::vector<Neuron::Value> {
+  std::vector<Neuron::Value> values(count);
+  for (auto& value : values) {
+    value = static_cast<Neuron::Value>(rng.uniform_int(-1, 1));
+  }
+  return values;
+}
+}  // namespace
+
+TEST_CASE("QuantizedLayer quantize", "[inference][quantized]") {
+  const std::vector<Neuron::Value> values = {-1.0f, 0.0f, 1.0f, 0.5f, 3.0f};
+  std::vector<uint8_t> quantized(QuantizedLayer::padded_size(values.size()));
+  REQUIRE(quantized.size() == QuantizedLayer::ROW_ALIGNMENT);
+
+  QuantizedLayer::quantize(values, quantized);
+  REQUIRE(quantized[0] == 1);
+  REQUIRE(quantized[1] == 64);
+  REQUIRE(quantized[2] == 127);
+  REQUIRE(quantized[3] == 96);   // round(31.5) + 64
+  REQUIRE(quantized[4] == 127);  // clamped
+  REQUIRE(quantized[5] == 64);   // padding
+}
+
+TEST_CASE("QuantizedLayer pre-activations track the float layer", "[inference][quantized]") {
+  RandomGenerator rng(5);
+  std::vector<Neuron> neurons(16);
+  for (Neuron& neuron : neurons) {
+    neuron.set_input_count(100);
+    neuron.randomize(rng);
+  }
+  QuantizedLayer layer;
+  layer.load(neurons, 100);
+  REQUIRE(layer.get_weight_bytes() < 100 * 16 * sizeof(float) / 2);
+
+  const auto inputs = random_inputs(rng, 100);
+  std::vector<uint8_t> quantized(QuantizedLayer::padded_size(100));
+  QuantizedLayer::quantize(inputs, quantized);
+  std::vector<Neuron::Value> sums(16);
+  layer.pre_activate(quantized, sums);
+
+  for (size_t neuron = 0; neuron < neurons.size(); ++neuron) {
+    // Error is bounded by the input step times the summed weight magnitudes
+    float magnitude = 0.0f;
+    for (size_t input = 0; input < 100; ++input) {
+      magnitude += std::abs(neurons[neuron].get_input_weight(input));
+    }
+    const float tolerance = magnitude / QuantizedLayer::ACTIVATION_SCALE;
+    REQUIRE(sums[neuron] == Approx(neurons[neuron].weighted_sum(inputs)).margin(tolerance));
+  }
+}
+
+TEST_CASE("QuantizedTernaryLayer tracks the float columns", "[inference][quantized]") {
+  RandomGenerator rng(8);
+  const size_t inputCount = 100;
+  std::vector<Neuron> neurons(16);
+  for (Neuron& neuron : neurons) {
+    neuron.set_input_count(inputCount);
+    neuron.randomize(rng);
+  }
+  QuantizedTernaryLayer layer;
+  layer.build(neurons, inputCount);
+  REQUIRE(layer.get_weight_bytes() < inputCount * neurons.size() * sizeof(float) / 2);
+
+  std::vector<TernaryLayer::Mask> positive(TernaryLayer::mask_count(inputCount));
+  std::vector<TernaryLayer::Mask> negative(positive.size());
+  std::vector<Neuron::Value> fromMasks(neurons.size());
+  std::vector<Neuron::Value> fromValues(neurons.size());
+  const auto inputs = random_ternary(rng, inputCount);
+  REQUIRE(TernaryLayer::pack(inputs, positive, negative));
+  layer.pre_activate(positive, negative, fromMasks);
+  layer.pre_activate(inputs, fromValues);
+
+  for (size_t neuron = 0; neuron < neurons.size(); ++neuron) {
+    // Each weight is off by at most half a step, a 127th of the neuron's largest weight
+    float largest = 0.0f;
+    for (size_t input = 0; input < inputCount; ++input) {
+      largest = std::max(largest, std::abs(neurons[neuron].get_input_weight(input)));
+    }
+    const float tolerance = largest / 254.0f * static_cast<float>(inputCount);
+    REQUIRE(fromMasks[neuron] == Approx(neurons[neuron].weighted_sum(inputs)).margin(tolerance));
+    REQUIRE(fromValues[neuron] == Approx(fromMasks[neuron]).margin(1e-4));
+  }
+
+  // Patching one input gives what evaluating the changed inputs does
+  auto changed = inputs;
+  changed[42] = inputs[42] == 1.0f ? -1.0f : 1.0f;
+  layer.add_column(42, changed[42] - inputs[42], fromMasks);
+  layer.pre_activate(changed, fromValues);
+  for (size_t neuron = 0; neuron < neurons.size(); ++neuron) {
+    REQUIRE(fromMasks[neuron] == Approx(fromValues[neuron]).margin(1e-4));
+  }
+}
+
+TEST_CASE("NeuralNetwork INT8 precision", "[inference][quantized]") {
+  RandomGenerator rng(11);
+  NeuralNetwork network;
+  network.randomize();
+  NeuralNetwork quantized(network);
+  quantized.set_precision(NeuralNetwork::INT8);
+  REQUIRE(quantized.get_precision() == NeuralNetwork::INT8);
+
+  // Individual outputs can flip near a tanh zero crossing, so bound the average error
+  double totalError = 0.0;
+  size_t samples = 0;
+  for (int trial = 0; trial < 50; ++trial) {
+    const auto inputs = random_inputs(rng, network.get_input_count());
+    network.set_input_values(inputs);
+    quantized.set_input_values(inputs);
+    const auto expected = network.get_output_values();
+    const auto actual = quantized.get_output_values();
+    REQUIRE(actual.size() == expected.size());
+    for (size_t index = 0; index < expected.size(); ++index) {
+      totalError += std::abs(actual[index] - expected[index]);
+      ++samples;
+    }
+  }
+  REQUIRE(totalError / static_cast<double>(samples) < 0.05);
+
+  SECTION("Switching back restores float outputs") {
+    quantized.set_precision(NeuralNetwork::FLOAT);
+    REQUIRE(quantized.get_output_values()[0] == network.get_output_values()[0]);
+  }
+
+  SECTION("Ternary inputs run incrementally and from the cache") {
+    const size_t maskCount = TernaryLayer::mask_count(quantized.get_input_count());
+    std::vector<TernaryLayer::Mask> positive(maskCount);
+    std::vector<TernaryLayer::Mask> negative(maskCount);
+    REQUIRE(TernaryLayer::pack(random_ternary(rng, quantized.get_input_count()), positive,
+                               negative));
+    const auto startPositive = positive;
+    const auto startNegative = negative;
+    quantized.set_input_masks(positive, negative);
+    const Neuron::Value start = quantized.get_output_values()[0];
+
+    for (size_t bit = 0; bit < 8; ++bit) {
+      positive[0] ^= TernaryLayer::Mask{1} << bit;
+      negative[0] &= ~positive[0];
+      quantized.set_input_masks(positive, negative);
+      // A copy starts without first-layer sums, so it evaluates the masks from scratch
+      NeuralNetwork reference(quantized);
+      reference.set_input_masks(positive, negative);
+      REQUIRE(quantized.get_output_values()[0] ==
+              Approx(reference.get_output_values()[0]).margin(1e-4));
+    }
+
+    const auto passes = quantized.get_forward_pass_count();
+    quantized.set_input_masks(startPositive, startNegative);
+    REQUIRE(quantized.get_output_values()[0] == start);
+    REQUIRE(quantized.get_forward_pass_count() == passes);
+    REQUIRE(quantized.get_output_cache_stats().hits > 0);
+  }
+
+  SECTION("Released float weights keep the outputs and free the layers") {
+    const auto inputs = random_ternary(rng, network.get_input_count());
+    quantized.set_input_values(inputs);
+    const Neuron::Value expected = quantized.get_output_values()[0];
+    const size_t bytes = quantized.memory_usage().bytes;
+    quantized.release_float_weights();
+    REQUIRE_FALSE(quantized.has_float_weights());
+    REQUIRE(quantized.memory_usage().bytes * 2 < bytes);
+
+    // Copies and assignments carry the int8 weights over
+    NeuralNetwork copy(quantized);
+    copy.set_input_values(inputs);
+    REQUIRE(copy.get_output_values()[0] == expected);
+    NeuralNetwork assigned;
+    assigned = quantized;
+    assigned.set_input_values(inputs);
+    REQUIRE(assigned.get_output_values()[0] == expected);
+
+    // Anything that needs the floats has to start again from the genome
+    REQUIRE_THROWS_AS(quantized.set_precision(NeuralNetwork::FLOAT), std::logic_error);
+    REQUIRE_THROWS_AS(quantized.randomize(), std::logic_error);
+    REQUIRE_THROWS_AS(quantized.to_json(), std::logic_error);
+    REQUIRE_THROWS_AS(network.release_float_weights(), std::logic_error);
+  }
+
+  SECTION("INT8 builds none of the float inference copies") {
+    const auto inputs = random_ternary(rng, network.get_input_count());
+    network.set_input_values(inputs);
+    network.get_output_values();
+    quantized.set_input_values(inputs);
+    quantized.get_output_values();
+    REQUIRE(quantized.memory_usage().bytes < network.memory_usage().bytes);
+
+    // Switching a float network over releases the columns and kernel it had built
+    const size_t floatBytes = network.memory_usage().bytes;
+    network.set_precision(NeuralNetwork::INT8);
+    network.get_output_values();
+    REQUIRE(network.memory_usage().bytes == quantized.memory_usage().bytes);
+    REQUIRE(network.memory_usage().bytes < floatBytes);
+  }
+}
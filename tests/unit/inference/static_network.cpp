@@ -0,0 +1,110 @@
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <vector>
+
+#include "inference/static_network.hpp"
+#include "neural_network.hpp"
+#include "random_generator.hpp"
+#include "tests/helpers/static_network.hpp"
+
+using Catch::Approx;
+
+namespace {
+auto hidden_layers(const NeuralNetwork& network) -> std::vector<NeuralNetwork::Layer> {
+  std::vector<NeuralNetwork::Layer> layers;
+  for (size_t index = 0; index < network.get_hidden_layer_count(); ++index) {
+    layers.push_back(network.get_hidden_layer(index));
+  }
+  return layers;
+}
+
+// Plain per-neuron dot products through every layer
+auto reference_outputs(const NeuralNetwork& network, std::vector<Neuron::Value> values)
+    -> std::vector<Neuron::Value> {
+  for (const auto& layer : hidden_layers(network)) {
+    std::vector<Neuron::Value> next;
+    for (const Neuron& neuron : layer) {
+      next.push_back(neuron.activate(values));
+    }
+    values = next;
+  }
+  std::vector<Neuron::Value> outputs;
+  for (const Neuron& neuron : network.get_output_layer()) {
+    outputs.push_back(neuron.activate(values));
+  }
+  return outputs;
+}
+}  // namespace
+
+TEST_CASE("StaticNetwork selection", "[inference][static_network]") {
+  NeuralNetwork network;
+
+  SECTION("The default topology is the production shape") {
+    REQUIRE(ProductionNetwork::matches(network.get_input_count(), hidden_layers(network),
+                                       network.get_output_layer()));
+    REQUIRE(Inference::ProductionTail::matches(hidden_layers(network),
+                                               network.get_output_layer()));
+    REQUIRE(Inference::make_static_network(hidden_layers(network), network.get_output_layer()) !=
+            nullptr);
+  }
+
+  SECTION("Other topologies fall back to the dynamic network") {
+    network.set_hidden_layer_neuron_count(12);
+    REQUIRE(Inference::make_static_network(hidden_layers(network), network.get_output_layer()) ==
+            nullptr);
+  }
+
+  SECTION("The kernel holds no first-layer weights, whatever the input count") {
+    auto kernel =
+        Inference::make_static_network(hidden_layers(network), network.get_output_layer());
+    REQUIRE(kernel->get_size_bytes() == sizeof(Inference::ProductionTail));
+    REQUIRE(kernel->get_size_bytes() < 100 * 16 * sizeof(Neuron::Value));
+
+    network.set_input_count(40);
+    REQUIRE(kernel->reload(hidden_layers(network), network.get_output_layer()));
+  }
+
+  SECTION("A kernel reloads weights of its own shape only") {
+    auto kernel =
+        Inference::make_static_network(hidden_layers(network), network.get_output_layer());
+    NeuralNetwork other;
+    other.randomize();
+    REQUIRE(kernel->reload(hidden_layers(other), other.get_output_layer()));
+
+    other.set_hidden_layer_neuron_count(12);
+    REQUIRE_FALSE(kernel->reload(hidden_layers(other), other.get_output_layer()));
+  }
+}
+
+TEST_CASE("StaticNetwork matches the dynamic network", "[inference][static_network]") {
+  RandomGenerator rng(99);
+  NeuralNetwork network;
+  network.randomize();
+
+  ProductionNetwork staticNetwork;
+  staticNetwork.load(hidden_layers(network), network.get_output_layer());
+
+  for (int trial = 0; trial < 10; ++trial) {
+    std::vector<Neuron::Value> inputs(network.get_input_count());
+    for (auto& input : inputs) {
+      input = static_cast<Neuron::Value>(rng.uniform(-1.0, 1.0));
+    }
+    const auto expected = reference_outputs(network, inputs);
+
+    std::vector<Neuron::Value> outputs(ProductionNetwork::OUTPUTS);
+    staticNetwork.compute(inputs, outputs);
+    network.set_input_values(inputs);
+    const auto networkOutputs = network.get_output_values();
+
+    for (size_t index = 0; index < expected.size(); ++index) {
+      REQUIRE(outputs[index] == Approx(expected[index]).margin(1e-5));
+      REQUIRE(networkOutputs[index] == Approx(expected[index]).margin(1e-5));
+    }
+  }
+
+  SECTION("Mismatched buffers are rejected") {
+    std::vector<Neuron::Value> inputs(10);
+    std::vector<Neuron::Value> outputs(2);
+    REQUIRE_THROWS_AS(staticNetwork.compute(inputs, outputs), std::invalid_argument);
+  }
+}
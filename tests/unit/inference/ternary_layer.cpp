@@ -0,0 +1,112 @@
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <vector>
+
+#include "inference/ternary_layer.hpp"
+#include "neural_network.hpp"
+#include "neuron.hpp"
+#include "random_generator.hpp"
+
+using Catch::Approx;
+using Inference::TernaryLayer;
+
+namespace {
+auto random_layer(RandomGenerator& rng, size_t neurons, size_t inputs) -> std::vector<Neuron> {
+  std::vector<Neuron> layer(neurons);
+  for (Neuron& neuron : layer) {
+    neuron.set_input_count(inputs);
+    neuron.randomize(rng);
+  }
+  return layer;
+}
+
+auto random_ternary(RandomGenerator& rng, size_t count) -> std::vector<Neuron::Value> {
+  std::vector<Neuron::Value> values(count);
+  for (auto& value : values) {
+    value = static_cast<Neuron::Value>(rng.uniform_int(-1, 1));
+  }
+  return values;
+}
+}  // namespace
+
+TEST_CASE("TernaryLayer pack", "[inference][ternary]") {
+  std::vector<TernaryLayer::Mask> positive(TernaryLayer::mask_count(70));
+  std::vector<TernaryLayer::Mask> negative(positive.size());
+  REQUIRE(positive.size() == 2);
+
+  SECTION("Splits +1 and -1 into separate masks") {
+    std::vector<Neuron::Value> values(70, 0.0f);
+    values[0] = 1.0f;
+    values[3] = -1.0f;
+    values[69] = 1.0f;
+    REQUIRE(TernaryLayer::pack(values, positive, negative));
+    REQUIRE(positive[0] == 0b1);
+    REQUIRE(positive[1] == (TernaryLayer::Mask{1} << 5));
+    REQUIRE(negative[0] == 0b1000);
+    REQUIRE(negative[1] == 0);
+  }
+
+  SECTION("Rejects values other than -1, 0 and +1") {
+    std::vector<Neuron::Value> values(70, 0.0f);
+    values[10] = 0.5f;
+    REQUIRE_FALSE(TernaryLayer::pack(values, positive, negative));
+  }
+
+  SECTION("Rejects mismatched mask sizes") {
+    std::vector<Neuron::Value> values(200, 0.0f);
+    REQUIRE_THROWS_AS(TernaryLayer::pack(values, positive, negative), std::invalid_argument);
+  }
+}
+
+TEST_CASE("TernaryLayer matches dense evaluation", "[inference][ternary]") {
+  RandomGenerator rng(42);
+  const size_t inputCount = 100;
+  const auto neurons = random_layer(rng, 16, inputCount);
+
+  TernaryLayer layer;
+  layer.build(neurons, inputCount);
+  REQUIRE(layer.get_input_count() == inputCount);
+  REQUIRE(layer.get_neuron_count() == neurons.size());
+
+  std::vector<TernaryLayer::Mask> positive(TernaryLayer::mask_count(inputCount));
+  std::vector<TernaryLayer::Mask> negative(positive.size());
+  std::vector<Neuron::Value> preActivations(neurons.size());
+
+  for (int trial = 0; trial < 20; ++trial) {
+    const auto inputs = random_ternary(rng, inputCount);
+    REQUIRE(TernaryLayer::pack(inputs, positive, negative));
+    layer.pre_activate(positive, negative, preActivations);
+
+    for (size_t neuron = 0; neuron < neurons.size(); ++neuron) {
+      const auto expected = neurons[neuron].activate(inputs);
+      REQUIRE(Neuron::activation_function(preActivations[neuron]) ==
+              Approx(expected).margin(1e-5));
+    }
+  }
+}
+
+TEST_CASE("NeuralNetwork ternary inputs match a dense reference", "[inference][ternary]") {
+  RandomGenerator rng(7);
+  NeuralNetwork network;
+  network.randomize();
+
+  const auto ternary = random_ternary(rng, network.get_input_count());
+  network.set_input_values(ternary);
+  const auto ternaryOutputs = network.get_output_values();
+
+  // Reference: evaluate every layer with plain dot products
+  std::vector<Neuron::Value> values = ternary;
+  for (size_t layerIndex = 0; layerIndex < network.get_hidden_layer_count(); ++layerIndex) {
+    std::vector<Neuron::Value> next;
+    for (const Neuron& neuron : network.get_hidden_layer(layerIndex)) {
+      next.push_back(neuron.activate(values));
+    }
+    values = next;
+  }
+
+  REQUIRE(ternaryOutputs.size() == network.get_output_layer().size());
+  for (size_t index = 0; index < ternaryOutputs.size(); ++index) {
+    REQUIRE(ternaryOutputs[index] ==
+            Approx(network.get_output_layer()[index].activate(values)).margin(1e-5));
+  }
+}
@@ -0,0 +1,34 @@
+#include <raylib.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+
+#include "label_batch.hpp"
+
+TEST_CASE("LabelBatch coordinate formatting", "[label_batch]") {
+  LabelBatch::Buffer buffer;
+
+  SECTION("Formats with two decimals") {
+    auto text = LabelBatch::format_coordinates({12.345f, -6.0f}, buffer);
+    REQUIRE(text == "(12.35, -6.00)");
+    REQUIRE(buffer[text.size()] == '\0');
+  }
+
+  SECTION("Large values are truncated to the buffer") {
+    auto text = LabelBatch::format_coordinates({1.0e30f, -1.0e30f}, buffer);
+    REQUIRE(text.size() == LabelBatch::MAX_LABEL_LENGTH);
+    REQUIRE(buffer[LabelBatch::MAX_LABEL_LENGTH] == '\0');
+  }
+}
+
+TEST_CASE("LabelBatch queueing", "[label_batch]") {
+  LabelBatch labels(10.0f, 1.0f);
+
+  REQUIRE(labels.size() == 0);
+  REQUIRE(labels.get_font_size() == 10.0f);
+  REQUIRE(labels.get_spacing() == 1.0f);
+
+  labels.add({0.0f, 0.0f}, "first", BLACK);
+  labels.add({1.0f, 1.0f}, std::string(100, 'x'), BLACK);
+  REQUIRE(labels.size() == 2);
+}
@@ -1,5 +1,6 @@
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <stdexcept>
 #include <vector>
 
 #include "neural_network.hpp"
@@ -21,6 +22,33 @@ TEST_CASE("Neural Network Calculations", "[neural_network]") {
     }
   }
 
+  SECTION("Input Buffer Writes") {
+    network.set_input_count(3);
+    network.set_hidden_layer_count(1);
+    network.set_hidden_layer_neuron_count(2);
+    network.set_output_neuron_count(2);
+
+    auto buffer = network.get_input_buffer();
+    REQUIRE(buffer.size() == 3);
+    buffer[0] = 0.25;
+    buffer[1] = -0.5;
+    buffer[2] = 1.0;
+
+    NeuralNetwork reference = network;
+    reference.set_input_values(NeuralNetwork::ValueVector{0.25, -0.5, 1.0});
+
+    const auto outputs = network.get_output_values();
+    const auto expected = reference.get_output_values();
+    REQUIRE(outputs.size() == 2);
+    REQUIRE(outputs[0] == Approx(expected[0]));
+    REQUIRE(outputs[1] == Approx(expected[1]));
+
+    // Writing through the buffer again invalidates the cached outputs
+    network.get_input_buffer()[0] = -0.25;
+    reference.set_input_values(NeuralNetwork::ValueVector{-0.25, -0.5, 1.0});
+    REQUIRE(network.get_output_values()[0] == Approx(reference.get_output_values()[0]));
+  }
+
   SECTION("Forward Propagation") {
     // Set up a simple network with known weights
     network.set_input_count(2);
@@ -164,4 +192,18 @@ TEST_CASE("Neural Network Calculations", "[neural_network]") {
     REQUIRE(output_values[0] == Approx(out1).margin(0.0001));
     REQUIRE(output_values[1] == Approx(out2).margin(0.0001));
   }
+
+  SECTION("Shape Changes Are Validated Again") {
+    network.set_input_count(3);
+    network.set_hidden_layer_count(1);
+    network.set_hidden_layer_neuron_count(2);
+    network.set_output_neuron_count(2);
+    network.set_input_values(NeuralNetwork::ValueVector{0.1, 0.2, 0.3});
+    REQUIRE(network.get_output_values().size() == 2);
+
+    // The output neurons still expect the two hidden values rather than the three inputs
+    network.set_hidden_layer_count(0);
+    network.set_input_values(NeuralNetwork::ValueVector{0.3, 0.2, 0.1});
+    REQUIRE_THROWS_AS(network.get_output_values(), std::runtime_error);
+  }
 }
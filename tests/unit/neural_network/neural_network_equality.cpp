@@ -129,6 +129,24 @@ TEST_CASE("NeuralNetwork equality operator", "[neural_network]") {
     REQUIRE_FALSE(network2 == network1);
   }
 
+  SECTION("Networks with different precisions are not equal") {
+    NeuralNetwork network1;
+    NeuralNetwork network2 = network1;
+    network2.set_precision(NeuralNetwork::INT8);
+
+    REQUIRE_FALSE(network1 == network2);
+    REQUIRE_FALSE(network2 == network1);
+  }
+
+  SECTION("Networks with different prune thresholds are not equal") {
+    NeuralNetwork network1;
+    NeuralNetwork network2 = network1;
+    network2.set_prune_threshold(0.05F);
+
+    REQUIRE_FALSE(network1 == network2);
+    REQUIRE_FALSE(network2 == network1);
+  }
+
   SECTION("Self equality") {
     NeuralNetwork network;
     network.set_input_count(5);
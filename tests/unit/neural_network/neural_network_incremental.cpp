@@ -0,0 +1,84 @@
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <vector>
+
+#include "neural_network.hpp"
+#include "random_generator.hpp"
+
+using Catch::Approx;
+
+namespace {
+// A copy starts without cached first-layer sums, so it always evaluates from scratch
+auto require_matches_full_compute(NeuralNetwork& network) -> void {
+  NeuralNetwork reference(network);
+  reference.set_input_values(network.get_input_values());
+
+  const auto outputs = network.get_output_values();
+  const auto expected = reference.get_output_values();
+  REQUIRE(outputs.size() == expected.size());
+  for (size_t index = 0; index < outputs.size(); ++index) {
+    REQUIRE(outputs[index] == Approx(expected[index]).margin(1e-4));
+  }
+}
+}  // namespace
+
+TEST_CASE("Neural Network Incremental Updates", "[neural_network]") {
+  RandomGenerator rng(1234);
+  NeuralNetwork network;
+  network.randomize();
+
+  NeuralNetwork::ValueVector inputs(network.get_input_count(), 0.0f);
+  for (auto& input : inputs) {
+    input = static_cast<Neuron::Value>(rng.uniform(-1.0, 1.0));
+  }
+  network.set_input_values(inputs);
+  network.get_output_values();
+
+  SECTION("A few changed inputs patch the first layer") {
+    for (int step = 0; step < 50; ++step) {
+      std::vector<NeuralNetwork::InputChange> changes;
+      for (int change = 0; change < 3; ++change) {
+        changes.push_back({static_cast<size_t>(rng.uniform_int(0, 99)),
+                           static_cast<Neuron::Value>(rng.uniform(-1.0, 1.0))});
+      }
+      network.apply_input_changes(changes);
+      require_matches_full_compute(network);
+    }
+  }
+
+  SECTION("Many changed inputs fall back to a full recompute") {
+    std::vector<NeuralNetwork::InputChange> changes;
+    for (size_t index = 0; index < network.get_input_count(); ++index) {
+      changes.push_back({index, 0.5f});
+    }
+    network.apply_input_changes(changes);
+    REQUIRE(network.get_input_values()[42] == 0.5f);
+    require_matches_full_compute(network);
+  }
+
+  SECTION("Changed input masks patch the first layer") {
+    std::vector<Inference::TernaryLayer::Mask> food = {0b1011, 0};
+    std::vector<Inference::TernaryLayer::Mask> wall = {0, 0b110};
+    network.set_input_masks(food, wall);
+    require_matches_full_compute(network);
+
+    for (int step = 0; step < 50; ++step) {
+      // Move a food bit and toggle a wall bit, as an ant stepping across cells would
+      food[0] = (food[0] << 1) | (food[0] >> 63);
+      wall[1] ^= Inference::TernaryLayer::Mask{1} << rng.uniform_int(0, 35);
+      food[1] &= ~wall[1];
+      network.set_input_masks(food, wall);
+      REQUIRE(network.get_input_values()[64 + 1] == ((wall[1] & 0b10) ? -1.0f : 0.0f));
+      require_matches_full_compute(network);
+    }
+  }
+
+  SECTION("Unchanged input masks keep the cached outputs") {
+    const std::vector<Inference::TernaryLayer::Mask> food = {0b1, 0};
+    const std::vector<Inference::TernaryLayer::Mask> wall = {0b10, 0};
+    network.set_input_masks(food, wall);
+    const auto first = network.get_output_values()[0];
+    network.set_input_masks(food, wall);
+    REQUIRE(network.get_output_values()[0] == first);
+  }
+}
@@ -0,0 +1,165 @@
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include "neural_network.hpp"
+#include "random_generator.hpp"
+
+using Catch::Approx;
+
+namespace {
+auto random_inputs(RandomGenerator& rng, size_t count) -> std::vector<Neuron::Value> {
+  std::vector<Neuron::Value> inputs(count);
+  rng.fill_uniform(inputs, -1.0F, 1.0F);
+  return inputs;
+}
+
+// Sensing-like inputs: mostly empty cells with a few walls (-1) and food (+1)
+auto ternary_inputs(RandomGenerator& rng, size_t count) -> std::vector<Neuron::Value> {
+  std::vector<Neuron::Value> inputs(count);
+  for (auto& input : inputs) {
+    const double cell = rng.uniform(0.0, 1.0);
+    input = cell < 0.1 ? -1.0F : cell < 0.2 ? 1.0F : 0.0F;
+  }
+  return inputs;
+}
+
+// Copy of network with every weight below threshold set to zero
+auto zero_small_weights(const NeuralNetwork& network, float threshold) -> NeuralNetwork {
+  NeuralNetwork pruned(network);
+  pruned.edit_neurons([&](size_t, size_t, Neuron& neuron) {
+    for (auto& weight : neuron.get_weights()) {
+      weight = std::abs(weight) < threshold ? 0.0F : weight;
+    }
+  });
+  return pruned;
+}
+
+auto require_same_outputs(NeuralNetwork& actual, NeuralNetwork& expected) -> void {
+  const auto outputs = actual.get_output_values();
+  const auto reference = expected.get_output_values();
+  REQUIRE(outputs.size() == reference.size());
+  for (size_t output = 0; output < outputs.size(); ++output) {
+    REQUIRE(outputs[output] == Approx(reference[output]).margin(1e-4));
+  }
+}
+}  // namespace
+
+TEST_CASE("Pruned networks match dense networks with the small weights zeroed",
+          "[neural_network][pruning]") {
+  RandomGenerator rng(17);
+  NeuralNetwork network;
+  network.randomize();
+
+  SECTION("A zero threshold disables pruning") {
+    REQUIRE(network.get_prune_threshold() == 0.0F);
+    network.set_input_values(random_inputs(rng, network.get_input_count()));
+    network.get_output_values();
+    REQUIRE(network.get_sparsity() == 0.0F);
+    REQUIRE_THROWS_AS(network.set_prune_threshold(-1.0F), std::invalid_argument);
+  }
+
+  SECTION("Outputs and sparsity") {
+    for (const float threshold : {0.5F, 1.5F, 2.5F}) {
+      NeuralNetwork pruned(network);
+      pruned.set_prune_threshold(threshold);
+      NeuralNetwork reference = zero_small_weights(network, threshold);
+
+      for (int pass = 0; pass < 5; ++pass) {
+        const auto inputs = random_inputs(rng, network.get_input_count());
+        pruned.set_input_values(inputs);
+        reference.set_input_values(inputs);
+        require_same_outputs(pruned, reference);
+      }
+      // Weights are uniform in [-3, 3], so about threshold / 3 of them are pruned
+      REQUIRE(pruned.get_sparsity() == Approx(threshold / 3.0F).margin(0.05));
+    }
+  }
+
+  SECTION("Ternary inputs and incremental changes use the pruned columns") {
+    network.set_prune_threshold(1.0F);
+    NeuralNetwork reference = zero_small_weights(network, 1.0F);
+    reference.set_prune_threshold(0.0F);
+
+    const auto inputs = ternary_inputs(rng, network.get_input_count());
+    network.set_input_values(inputs);
+    reference.set_input_values(inputs);
+    require_same_outputs(network, reference);
+
+    for (int step = 0; step < 20; ++step) {
+      const size_t index = static_cast<size_t>(step * 7) % network.get_input_count();
+      const Neuron::Value value = step % 3 == 0 ? 0.0F : step % 3 == 1 ? 1.0F : -1.0F;
+      const std::vector<NeuralNetwork::InputChange> changes{{index, value}};
+      network.apply_input_changes(changes);
+      reference.apply_input_changes(changes);
+      require_same_outputs(network, reference);
+    }
+  }
+
+  SECTION("Topologies without a static kernel prune their later layers too") {
+    network.set_hidden_layer_neuron_count(12);
+    network.set_hidden_layer_count(3);
+    network.randomize();
+    network.set_prune_threshold(1.0F);
+    NeuralNetwork reference = zero_small_weights(network, 1.0F);
+    reference.set_prune_threshold(0.0F);
+
+    const auto inputs = ternary_inputs(rng, network.get_input_count());
+    network.set_input_values(inputs);
+    reference.set_input_values(inputs);
+    require_same_outputs(network, reference);
+  }
+
+  SECTION("Pruned brains hold only the kept weights") {
+    NeuralNetwork pruned(network);
+    pruned.set_prune_threshold(1.5F);
+    const auto inputs = ternary_inputs(rng, network.get_input_count());
+    network.set_input_values(inputs);
+    pruned.set_input_values(inputs);
+    network.get_output_values();
+    pruned.get_output_values();
+    // The ternary columns and static kernel give way to the block-sparse copy, which holds
+    // about half of the weights at this threshold
+    REQUIRE(pruned.memory_usage().bytes < network.memory_usage().bytes);
+
+    pruned.set_prune_threshold(0.0F);
+    pruned.get_output_values();
+    REQUIRE(pruned.memory_usage().bytes == network.memory_usage().bytes);
+  }
+
+  SECTION("Hidden neurons that cannot reach the outputs are skipped") {
+    network.edit_neurons([](size_t layerIndex, size_t neuronIndex, Neuron& neuron) {
+      // Second hidden layer neuron 2 feeds nothing, and only it reads first-layer neuron 7
+      if (layerIndex == 2) {
+        neuron.set_input_weight(2, 0.1F);
+      } else if (layerIndex == 1 && neuronIndex != 2) {
+        neuron.set_input_weight(7, 0.1F);
+      }
+    });
+    network.set_prune_threshold(1.0F);
+    NeuralNetwork reference = zero_small_weights(network, 1.0F);
+    reference.set_prune_threshold(0.0F);
+
+    for (int pass = 0; pass < 5; ++pass) {
+      const auto inputs = ternary_inputs(rng, network.get_input_count());
+      network.set_input_values(inputs);
+      reference.set_input_values(inputs);
+      require_same_outputs(network, reference);
+    }
+  }
+
+  SECTION("Copies keep the threshold and weight changes rebuild the pruned weights") {
+    network.set_prune_threshold(1.0F);
+    NeuralNetwork copy(network);
+    REQUIRE(copy.get_prune_threshold() == 1.0F);
+
+    copy.randomize();
+    copy.set_input_values(random_inputs(rng, copy.get_input_count()));
+    NeuralNetwork reference = zero_small_weights(copy, 1.0F);
+    reference.set_prune_threshold(0.0F);
+    reference.set_input_values(copy.get_input_values());
+    require_same_outputs(copy, reference);
+  }
+}
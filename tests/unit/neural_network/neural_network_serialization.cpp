@@ -136,6 +136,31 @@ TEST_CASE("Neural Network Serialization", "[neural_network]") {
     REQUIRE(reconstructed == original);
   }
 
+  SECTION("Precision Serialization") {
+    NeuralNetwork original;
+    original.set_precision(NeuralNetwork::INT8);
+
+    auto json = original.to_json();
+    REQUIRE(json["precision"] == NeuralNetwork::INT8);
+    REQUIRE(NeuralNetwork(json).get_precision() == NeuralNetwork::INT8);
+
+    // Networks saved before the precision was recorded run in float
+    json.erase("precision");
+    REQUIRE(NeuralNetwork(json).get_precision() == NeuralNetwork::FLOAT);
+  }
+
+  SECTION("Prune Threshold Serialization") {
+    NeuralNetwork original;
+    original.set_prune_threshold(0.05F);
+
+    auto json = original.to_json();
+    REQUIRE(json["prune_threshold"] == 0.05F);
+    REQUIRE(NeuralNetwork(json) == original);
+
+    json.erase("prune_threshold");
+    REQUIRE(NeuralNetwork(json).get_prune_threshold() == 0.0F);
+  }
+
   SECTION("Empty Network Serialization") {
     NeuralNetwork network;
     network.set_input_count(0);
@@ -0,0 +1,64 @@
+#include <catch2/catch_test_macros.hpp>
+#include <vector>
+
+#include "../food/food_test_helper.hpp"
+#include "population.hpp"
+#include "world.hpp"
+
+TEST_CASE("Population history", "[population]") {
+  MockTextureCache textureCache;
+  World world(textureCache);
+  Population& population = world.get_population();
+  population.set_size(10);
+  world.get_resources().set_food_count(0);
+  std::vector<Population::History::Point> points;
+
+  SECTION("Every tick adds one sample to each per-tick series") {
+    for (int tick = 0; tick < 5; ++tick) {
+      world.update(0.1f);
+    }
+    for (auto series : {Population::MEAN_FITNESS, Population::TOP_FITNESS,
+                        Population::PANGENOME_SIZE, Population::BIRTHS, Population::DEATHS}) {
+      REQUIRE(population.get_history(series).size() == 5);
+    }
+
+    // The first tick creates the whole population
+    population.get_history(Population::BIRTHS).sample(0, 5, 5, points);
+    REQUIRE(points.front().max == 10.0);
+  }
+
+  SECTION("Retired genomes are recorded with their fitness") {
+    world.update(0.0f);
+    auto& ants = population.get_ants();
+    ants[2].set_remaining_lives(0);
+    ants[2].set_energy(1e-6f);
+    world.update(0.5f);
+
+    REQUIRE(population.get_history(Population::GENOME_FITNESS).size() == 1);
+    population.get_history(Population::DEATHS).sample(0, 2, 2, points);
+    REQUIRE(points.back().max == 1.0);
+    population.get_history(Population::PANGENOME_SIZE).sample(0, 2, 2, points);
+    REQUIRE(points.back().max == 1.0);
+    population.get_history(Population::TOP_FITNESS).sample(0, 2, 2, points);
+    REQUIRE(points.back().max ==
+            static_cast<float>(population.get_pangenome().get_top_fitness()));
+  }
+
+  SECTION("Copies keep the history and report its buckets") {
+    const Util::MemoryUsage empty = population.get_history_memory_usage();
+    REQUIRE(empty.bytes == 0);
+    for (int tick = 0; tick < 3; ++tick) {
+      world.update(0.1f);
+    }
+
+    const Population copy = population;
+    for (size_t series = 0; series < Population::HISTORY_SERIES_COUNT; ++series) {
+      const auto name = static_cast<Population::HistorySeries>(series);
+      REQUIRE(copy.get_history(name).size() == population.get_history(name).size());
+    }
+    const Util::MemoryUsage usage = copy.get_history_memory_usage();
+    REQUIRE(usage.bytes == population.get_history_memory_usage().bytes);
+    REQUIRE(usage.allocations == Population::HISTORY_SERIES_COUNT - 1);  // no genome retired yet
+    REQUIRE(world.get_memory_report().history.bytes == usage.bytes);
+  }
+}
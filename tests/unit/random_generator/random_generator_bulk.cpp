@@ -0,0 +1,97 @@
+#include <algorithm>
+#include <bit>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <vector>
+
+#include "random_generator.hpp"
+
+namespace {
+auto mean(const std::vector<float>& values) -> double {
+  double sum = 0.0;
+  for (const float value : values) {
+    sum += value;
+  }
+  return sum / static_cast<double>(values.size());
+}
+
+auto stddev(const std::vector<float>& values) -> double {
+  const double average = mean(values);
+  double sum = 0.0;
+  for (const float value : values) {
+    sum += (value - average) * (value - average);
+  }
+  return std::sqrt(sum / static_cast<double>(values.size()));
+}
+}  // namespace
+
+TEST_CASE("RandomGenerator bulk generation", "[random]") {
+  RandomGenerator rng(1234);
+
+  SECTION("Seeded generators produce the same bulk streams") {
+    RandomGenerator other(1234);
+    std::vector<uint64_t> a(37);
+    std::vector<uint64_t> b(37);
+    rng.fill_bits(a);
+    other.fill_bits(b);
+    REQUIRE(a == b);
+    rng.fill_bits(a);
+    REQUIRE(a != b);
+  }
+
+  SECTION("Bits are balanced") {
+    std::vector<uint64_t> words(10000);
+    rng.fill_bits(words);
+    size_t ones = 0;
+    for (const uint64_t word : words) {
+      ones += std::popcount(word);
+    }
+    const double share = static_cast<double>(ones) / (64.0 * static_cast<double>(words.size()));
+    REQUIRE(std::abs(share - 0.5) < 0.005);
+  }
+
+  SECTION("Uniform values stay in range with the right mean") {
+    std::vector<float> values(100001);
+    rng.fill_uniform(values, -3.0F, 3.0F);
+    REQUIRE(std::all_of(
+        values.begin(), values.end(), [](float v) { return v >= -3.0F && v < 3.0F; }));
+    REQUIRE(std::abs(mean(values)) < 0.03);
+    REQUIRE(std::abs(stddev(values) - std::sqrt(3.0)) < 0.03);
+  }
+
+  SECTION("Normal values follow the requested distribution including the tails") {
+    std::vector<float> values(200000);
+    rng.fill_normal(values);
+    REQUIRE(std::abs(mean(values)) < 0.01);
+    REQUIRE(std::abs(stddev(values) - 1.0) < 0.01);
+    // P(|x| > 3) = 0.0027 and P(|x| > 3.44) (beyond the ziggurat base) = 0.00058
+    const auto beyond = [&](float limit) {
+      return static_cast<double>(std::count_if(values.begin(), values.end(), [&](float v) {
+               return std::abs(v) > limit;
+             })) /
+             static_cast<double>(values.size());
+    };
+    REQUIRE(std::abs(beyond(3.0F) - 0.0027) < 0.0006);
+    REQUIRE(std::abs(beyond(3.5F) - 0.000465) < 0.0002);
+
+    rng.fill_normal(values, 2.0F, 0.1F);
+    REQUIRE(std::abs(mean(values) - 2.0) < 0.002);
+    REQUIRE(std::abs(stddev(values) - 0.1) < 0.002);
+  }
+
+  SECTION("Bernoulli masks set bits with probability p") {
+    REQUIRE(rng.bernoulli_mask(0.0) == 0);
+    REQUIRE(rng.bernoulli_mask(-1.0) == 0);
+    REQUIRE(rng.bernoulli_mask(1.0) == ~uint64_t{0});
+
+    for (const double p : {0.5, 0.25, 0.1, 0.01}) {
+      size_t ones = 0;
+      constexpr size_t MASKS = 20000;
+      for (size_t i = 0; i < MASKS; ++i) {
+        ones += std::popcount(rng.bernoulli_mask(p));
+      }
+      const double share = static_cast<double>(ones) / (64.0 * MASKS);
+      REQUIRE(std::abs(share - p) < 0.005);
+    }
+  }
+}
@@ -0,0 +1,120 @@
+#include <catch2/catch_test_macros.hpp>
+#include <vector>
+
+#include "../food/food_test_helper.hpp"
+#include "food.hpp"
+#include "population.hpp"
+#include "raylib.h"
+#include "resources.hpp"
+#include "world.hpp"
+
+namespace {
+class PopulationContactAccess : public Population {
+ public:
+  PopulationContactAccess(World& world) : Population(world) {}
+
+  using Population::_ants;
+  using Population::reproduce;
+};
+
+class ResourcesContactAccess : public Resources {
+ public:
+  ResourcesContactAccess(World& world) : Resources(world) {}
+
+  using Resources::_food;
+  using Resources::update_spatial_index;
+};
+
+// The contact each uneaten piece of food should get, from a linear scan over the ants
+auto brute_force_contacts(ResourcesContactAccess& resources, PopulationContactAccess& population)
+    -> std::vector<Resources::Contact> {
+  std::vector<Resources::Contact> contacts;
+  for (size_t food = 0; food < resources._food.size(); ++food) {
+    const Food& item = resources._food[food];
+    if (item.is_eaten()) {
+      continue;
+    }
+    auto touching = population.get_collisions(item.get_position(), item.get_radius());
+    if (!touching.empty()) {
+      const auto ant = static_cast<size_t>(&touching.front().get() - population._ants.data());
+      contacts.push_back({food, ant});
+    }
+  }
+  return contacts;
+}
+}  // namespace
+
+TEST_CASE("Resources contact generation", "[resources]") {
+  MockTextureCache textureCache;
+  World world(textureCache);
+  PopulationContactAccess population(world);
+  ResourcesContactAccess resources(world);
+
+  population.set_size(40);
+  population.reproduce();
+  REQUIRE(population._ants.size() == 40);
+
+  SECTION("No food gives no contacts") {
+    resources.update_spatial_index();
+    REQUIRE(resources.generate_contacts(population).empty());
+  }
+
+  SECTION("Contacts match a linear scan, ties going to the lowest ant index") {
+    // Food on top of every ant, with pairs of ants stacked so several touch the same food
+    for (size_t index = 0; index < population._ants.size(); ++index) {
+      if (index % 2 == 1) {
+        population._ants[index].set_position(population._ants[index - 1].get_position());
+      }
+      resources._food.emplace_back(population._ants[index].get_position(), textureCache);
+    }
+    resources._food.emplace_back(Vector2{-10000.0F, -10000.0F}, textureCache);
+    resources.update_spatial_index();
+    population.refresh_spatial_index();
+
+    const auto contacts = resources.generate_contacts(population);
+    const auto expected = brute_force_contacts(resources, population);
+    REQUIRE(contacts.size() == expected.size());
+    REQUIRE(contacts.size() == population._ants.size());
+    for (size_t index = 0; index < contacts.size(); ++index) {
+      REQUIRE(contacts[index].food == expected[index].food);
+      REQUIRE(contacts[index].ant == expected[index].ant);
+      REQUIRE(contacts[index].ant % 2 == 0);
+    }
+  }
+
+  SECTION("Eaten food is skipped") {
+    resources._food.emplace_back(population._ants[0].get_position(), textureCache);
+    resources._food.emplace_back(population._ants[1].get_position(), textureCache);
+    resources._food[0].eat(population._ants[0]);
+    resources.update_spatial_index();
+
+    const auto contacts = resources.generate_contacts(population);
+    REQUIRE(contacts.size() == 1);
+    REQUIRE(contacts[0].food == 1);
+  }
+
+  SECTION("Feeding eats each touched piece of food once") {
+    for (size_t index = 0; index < 10; ++index) {
+      resources._food.emplace_back(population._ants[index].get_position(), textureCache);
+    }
+    resources.feed_ants(population);
+
+    for (size_t index = 0; index < 10; ++index) {
+      REQUIRE(resources._food[index].is_eaten());
+    }
+    REQUIRE(resources.generate_contacts(population).empty());
+  }
+}
+
+TEST_CASE("Resources food_in_rect", "[resources]") {
+  MockTextureCache textureCache;
+  World world(textureCache);
+  ResourcesContactAccess resources(world);
+
+  resources._food.emplace_back(Vector2{100.0F, 100.0F}, textureCache);
+  resources.update_spatial_index();
+
+  REQUIRE(resources.food_in_rect({90.0F, 90.0F, 20.0F, 20.0F}));
+  REQUIRE(resources.food_in_rect({100.0F + Food::RADIUS - 1.0F, 95.0F, 10.0F, 10.0F}));
+  REQUIRE_FALSE(resources.food_in_rect({300.0F, 300.0F, 20.0F, 20.0F}));
+}
@@ -112,3 +112,76 @@ TEST_CASE("Surroundings copy constructor", "[surroundings]") {
   REQUIRE(encoded[0] == 1.0f);   // FOOD
   REQUIRE(encoded[3] == -1.0f);  // WALL
 }
+
+TEST_CASE("Surroundings encode into buffer", "[surroundings]") {
+  Surroundings surroundings;
+  surroundings.set_dimensions(2, 2);
+  surroundings.set_type(1, 0, Surroundings::FOOD);
+  surroundings.set_type(0, 1, Surroundings::WALL);
+
+  std::vector<Neuron::Value> buffer(4, 5.0f);
+  surroundings.encode(buffer);
+  REQUIRE(buffer == std::vector<Neuron::Value>{0.0f, 1.0f, -1.0f, 0.0f});
+  REQUIRE_FALSE(surroundings.changed());
+
+  // Encoding agrees with the cached vector, which is rebuilt lazily
+  REQUIRE(surroundings.get_encoded_surroundings() == buffer);
+
+  std::vector<Neuron::Value> wrongSize(3);
+  REQUIRE_THROWS_AS(surroundings.encode(wrongSize), std::invalid_argument);
+}
+
+TEST_CASE("Surroundings set row", "[surroundings]") {
+  Surroundings surroundings;
+  surroundings.set_dimensions(10, 10);
+  surroundings.get_encoded_surroundings();
+
+  // Row 6 covers bits 60..69 and straddles the two mask words
+  surroundings.set_row(6, 0b0000000101, 0b1000000000);
+  REQUIRE(surroundings.changed());
+  REQUIRE(surroundings.get_type(0, 6) == Surroundings::FOOD);
+  REQUIRE(surroundings.get_type(1, 6) == Surroundings::EMPTY);
+  REQUIRE(surroundings.get_type(2, 6) == Surroundings::FOOD);
+  REQUIRE(surroundings.get_type(9, 6) == Surroundings::WALL);
+  REQUIRE(surroundings.get_type(0, 5) == Surroundings::EMPTY);
+  REQUIRE(surroundings.get_type(0, 7) == Surroundings::EMPTY);
+
+  const auto& encoded = surroundings.get_encoded_surroundings();
+  REQUIRE(encoded[60] == 1.0f);
+  REQUIRE(encoded[62] == 1.0f);
+  REQUIRE(encoded[69] == -1.0f);
+
+  // Writing the same row again is not a change
+  surroundings.set_row(6, 0b0000000101, 0b1000000000);
+  REQUIRE_FALSE(surroundings.changed());
+
+  REQUIRE_THROWS_AS(surroundings.set_row(10, 0, 0), std::out_of_range);
+  REQUIRE_THROWS_AS(surroundings.set_row(0, 0b1, 0b1), std::invalid_argument);
+}
+
+TEST_CASE("Surroundings equality, diff and hash", "[surroundings]") {
+  Surroundings previous;
+  previous.set_dimensions(10, 10);
+  previous.set_type(3, 3, Surroundings::FOOD);
+  previous.set_type(8, 9, Surroundings::WALL);
+
+  Surroundings current(previous);
+  REQUIRE(current == previous);
+  REQUIRE(current.hash() == previous.hash());
+
+  std::vector<Surroundings::Mask> changed(current.get_food_mask().size());
+  REQUIRE(current.diff(previous, changed) == 0);
+
+  current.set_type(3, 3, Surroundings::EMPTY);
+  current.set_type(0, 0, Surroundings::WALL);
+  REQUIRE_FALSE(current == previous);
+  REQUIRE(current.hash() != previous.hash());
+  REQUIRE(current.diff(previous, changed) == 2);
+  REQUIRE(changed[0] == ((Surroundings::Mask{1} << 33) | Surroundings::Mask{1}));
+  REQUIRE(changed[1] == 0);
+
+  Surroundings other;
+  other.set_dimensions(5, 5);
+  REQUIRE_FALSE(other == previous);
+  REQUIRE_THROWS_AS(other.diff(previous, changed), std::invalid_argument);
+}
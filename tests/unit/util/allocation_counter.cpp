@@ -0,0 +1,33 @@
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <vector>
+
+#include "util/allocation_counter.hpp"
+
+TEST_CASE("Allocation counter", "[util]") {
+  // The tests link the counting operator new; the game does not
+  REQUIRE(Util::AllocationCounter::is_enabled());
+
+  SECTION("Counts allocations made through operator new") {
+    const auto before = Util::AllocationCounter::get();
+    auto values = std::make_unique<std::vector<double>>(1000, 1.0);
+    const auto counted = Util::AllocationCounter::get() - before;
+
+    REQUIRE(counted.allocations >= 2);
+    REQUIRE(counted.bytes >= 1000 * sizeof(double));
+    REQUIRE(values->size() == 1000);
+  }
+
+  SECTION("Code that does not allocate is not counted") {
+    std::vector<int> values(100, 1);
+    const auto before = Util::AllocationCounter::get();
+    int sum = 0;
+    for (const int value : values) {
+      sum += value;
+    }
+    const auto counted = Util::AllocationCounter::get() - before;
+
+    REQUIRE(sum == 100);
+    REQUIRE(counted.allocations == 0);
+  }
+}
@@ -0,0 +1,67 @@
+#include "util/half.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+TEST_CASE("Half precision conversions", "[half]") {
+  SECTION("FP16 round trips exactly representable values") {
+    for (float value : {0.0F, -0.0F, 1.0F, -2.5F, 0.099975586F, 65504.0F, 6.1035156e-05F}) {
+      REQUIRE(Util::fp16_to_float(Util::float_to_fp16(value)) == value);
+    }
+    REQUIRE(Util::float_to_fp16(1.0F) == 0x3C00);
+    REQUIRE(Util::float_to_fp16(-2.0F) == 0xC000);
+  }
+
+  SECTION("FP16 rounds to nearest even and saturates to infinity") {
+    // 1 + 2^-11 is exactly halfway between 1 and the next fp16 value; ties go to even
+    REQUIRE(Util::float_to_fp16(1.0F + std::ldexp(1.0F, -11)) == 0x3C00);
+    REQUIRE(Util::float_to_fp16(1.0F + 3.0F * std::ldexp(1.0F, -11)) == 0x3C02);
+    REQUIRE(std::isinf(Util::fp16_to_float(Util::float_to_fp16(1.0e6F))));
+    // Subnormals survive the round trip
+    const float subnormal = std::ldexp(1.0F, -20);
+    REQUIRE(Util::fp16_to_float(Util::float_to_fp16(subnormal)) == subnormal);
+  }
+
+  SECTION("BF16 keeps the float range with 8 significant bits") {
+    REQUIRE(Util::float_to_bf16(1.0F) == 0x3F80);
+    const float large = Util::bf16_to_float(Util::float_to_bf16(1.0e30F));
+    REQUIRE(std::abs(large - 1.0e30F) <= 1.0e30F * std::ldexp(1.0F, -8));
+    REQUIRE(Util::bf16_to_float(Util::float_to_bf16(-3.0F)) == -3.0F);
+    // 1 + 2^-8 is halfway between 1 and 1 + 2^-7; ties go to even
+    REQUIRE(Util::float_to_bf16(1.0F + std::ldexp(1.0F, -8)) == 0x3F80);
+    REQUIRE(std::isnan(Util::bf16_to_float(
+        Util::float_to_bf16(std::numeric_limits<float>::quiet_NaN()))));
+  }
+
+  SECTION("Bulk conversions match the scalar ones") {
+    std::vector<float> values;
+    for (int i = 0; i < 37; ++i) {
+      values.push_back(std::sin(static_cast<float>(i)) * 3.0F);
+    }
+    std::vector<Util::Half> packed(values.size());
+    std::vector<float> widened(values.size());
+
+    for (auto format : {Util::FP16, Util::BF16}) {
+      Util::narrow(values, packed, format);
+      Util::widen(packed, widened, format);
+      for (size_t i = 0; i < values.size(); ++i) {
+        const auto expected = format == Util::FP16 ? Util::float_to_fp16(values[i])
+                                                   : Util::float_to_bf16(values[i]);
+        REQUIRE(packed[i] == expected);
+        const float tolerance = format == Util::FP16 ? 2.0e-3F : 1.6e-2F;
+        REQUIRE(std::abs(widened[i] - values[i]) <= tolerance);
+      }
+    }
+  }
+
+  SECTION("Bulk conversions reject bad arguments") {
+    std::vector<float> values(4, 1.0F);
+    std::vector<Util::Half> packed(3);
+    REQUIRE_THROWS_AS(Util::narrow(values, packed, Util::FP16), std::invalid_argument);
+    packed.resize(4);
+    REQUIRE_THROWS_AS(Util::narrow(values, packed, Util::FP32), std::invalid_argument);
+    REQUIRE_THROWS_AS(Util::widen(packed, values, Util::FP32), std::invalid_argument);
+  }
+}
@@ -0,0 +1,79 @@
+#include <catch2/catch_test_macros.hpp>
+#include <vector>
+
+#include "../food/food_test_helper.hpp"
+#include "genome.hpp"
+#include "util/allocation_counter.hpp"
+#include "util/memory_usage.hpp"
+#include "world.hpp"
+
+TEST_CASE("Memory usage", "[util]") {
+  SECTION("Vectors count their reserved capacity as one allocation") {
+    std::vector<float> values;
+    REQUIRE(Util::MemoryUsage{}.add(values).allocations == 0);
+
+    values.reserve(100);
+    values.push_back(1.0F);
+    const Util::MemoryUsage usage = Util::MemoryUsage{}.add(values);
+    REQUIRE(usage.bytes == 100 * sizeof(float));
+    REQUIRE(usage.allocations == 1);
+  }
+
+  SECTION("A copied genome owns what copying it allocated") {
+    Genome genome;
+    genome.randomize();
+
+    const auto before = Util::AllocationCounter::get();
+    const Genome copy = genome;
+    const auto counted = Util::AllocationCounter::get() - before;
+
+    const Util::MemoryUsage usage = copy.memory_usage();
+    REQUIRE(usage.allocations == counted.allocations);
+    REQUIRE(usage.bytes == counted.bytes);
+    REQUIRE(usage.bytes >= copy.get_weight_bytes());
+  }
+
+  SECTION("Compacting a genome releases its float layers") {
+    Genome genome;
+    genome.randomize();
+    const Util::MemoryUsage expanded = genome.memory_usage();
+
+    genome.compact(Util::FP16);
+    const Util::MemoryUsage compact = genome.memory_usage();
+    REQUIRE(compact.bytes < expanded.bytes);
+    REQUIRE(compact.bytes >= genome.get_weight_bytes());
+    REQUIRE(Util::MemoryUsage::footprint(genome).bytes == compact.bytes + sizeof(Genome));
+  }
+
+  SECTION("A world reports its subsystems with their object counts") {
+    MockTextureCache textureCache;
+    World world(textureCache);
+    world.get_population().set_size(30);
+    world.get_resources().set_food_count(20);
+    for (int tick = 0; tick < 50; ++tick) {
+      world.update(0.1F);
+    }
+
+    const World::MemoryReport report = world.get_memory_report();
+    REQUIRE(report.antCount == 30);
+    REQUIRE(report.foodCount == 20);
+    REQUIRE(report.genomeCount == world.get_population().get_pangenome().size());
+
+    // Each ant's slot is counted along with what its genome and brain own
+    Util::MemoryUsage ants;
+    for (const Ant& ant : world.get_population().get_ants()) {
+      ants += Util::MemoryUsage::footprint(ant);
+    }
+    REQUIRE(report.ants.bytes >= ants.bytes);
+    REQUIRE(report.ants.allocations > ants.allocations);
+    REQUIRE(report.resources.bytes >= report.foodCount * sizeof(Food));
+
+    REQUIRE(report.history.bytes == world.get_population().get_history_memory_usage().bytes);
+
+    const Util::MemoryUsage parts =
+        report.ants + report.pangenome + report.resources + report.history;
+    REQUIRE(report.total.bytes >= parts.bytes);
+    REQUIRE(report.total.allocations >= parts.allocations);
+    REQUIRE(report.total.bytes == world.memory_usage().bytes);
+  }
+}
@@ -91,6 +91,18 @@ TEST_CASE("World bounds and spawn logic", "[world]") {
     }
   }
 
+  SECTION("Resizing moves the spawn bounds with the world") {
+    TextureCache textureCache;
+    World world(textureCache);
+    world.set_bounds({0.0f, 0.0f, 4000.0f, 2000.0f});
+
+    REQUIRE(world.get_bounds().width == 4000.0f);
+    REQUIRE(world.get_bounds().height == 2000.0f);
+    REQUIRE(world.get_spawn_bounds().x == 4000.0f * world.get_spawn_margin());
+    REQUIRE_FALSE(world.out_of_bounds({3000.0f, 1500.0f}));
+    REQUIRE(world.out_of_bounds({3000.0f, 2500.0f}));
+  }
+
   SECTION("Update functionality") {
     TextureCache textureCache;
     World world(textureCache);
@@ -60,6 +60,26 @@ TEST_CASE("World equality operator", "[world]") {
     REQUIRE_FALSE(world2 == world1);
   }
 
+  SECTION("Worlds with different brain settings are not equal") {
+    TextureCache textureCache;
+    World world1(textureCache);
+    World world2(textureCache);
+
+    world2.set_inference_precision(NeuralNetwork::INT8);
+    REQUIRE_FALSE(world1 == world2);
+    world2.set_inference_precision(NeuralNetwork::FLOAT);
+
+    world2.set_weight_format(Util::FP16);
+    REQUIRE_FALSE(world1 == world2);
+    world2.set_weight_format(Util::FP32);
+
+    world2.set_prune_threshold(0.05f);
+    REQUIRE_FALSE(world1 == world2);
+    world2.set_prune_threshold(0.0f);
+
+    REQUIRE(world1 == world2);
+  }
+
   SECTION("Self equality") {
     TextureCache textureCache;
     World world(textureCache);
@@ -37,6 +37,20 @@ TEST_CASE("World JSON serialization", "[world]") {
     REQUIRE(restored.get_resources().get_food_count() == 150);
   }
 
+  SECTION("JSON round trip keeps the brain settings") {
+    TextureCache textureCache;
+    World original(textureCache);
+    original.set_inference_precision(NeuralNetwork::INT8);
+    original.set_weight_format(Util::BF16);
+    original.set_prune_threshold(0.05f);
+
+    World restored(original.to_json(), textureCache);
+    REQUIRE(restored == original);
+    REQUIRE(restored.get_inference_precision() == NeuralNetwork::INT8);
+    REQUIRE(restored.get_weight_format() == Util::BF16);
+    REQUIRE(restored.get_prune_threshold() == 0.05f);
+  }
+
   SECTION("JSON constructor with valid data") {
     TextureCache textureCache;
     nlohmann::json j;
@@ -0,0 +1,66 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "../food/food_test_helper.hpp"
+#include "ant.hpp"
+#include "population.hpp"
+#include "resources.hpp"
+#include "world.hpp"
+
+TEST_CASE("World tick phases", "[world]") {
+  MockTextureCache textureCache;
+  World world(textureCache);
+  Population& population = world.get_population();
+  population.set_size(20);
+  // No food, so no ant can eat its way out of the energy the sections set
+  world.get_resources().set_food_count(0);
+
+  SECTION("Every phase is timed once the world has ticked") {
+    world.update(0.1f);
+    const auto& profile = world.get_tick_profile();
+    for (size_t phase = 0; phase < Util::TickProfile::PHASE_COUNT; ++phase) {
+      REQUIRE(profile.get_seconds(static_cast<Util::TickProfile::Phase>(phase)) >= 0.0);
+    }
+    REQUIRE(profile.get_total_seconds() > 0.0);
+    REQUIRE(population.get_ants().size() == 20);
+  }
+
+  SECTION("The work done by a tick is counted") {
+    world.update(0.0f);
+    world.update(0.1f);
+    const auto& profile = world.get_tick_profile();
+    REQUIRE(profile.get_count(Util::TickProfile::ANTS_UPDATED) == 20);
+    // Every brain computes on its first tick; later ticks may reuse cached answers
+    REQUIRE(profile.get_count(Util::TickProfile::FORWARD_PASSES) == 20);
+
+    world.update(0.1f);
+    REQUIRE(profile.get_count(Util::TickProfile::ANTS_UPDATED) == 20);
+    REQUIRE(profile.get_count(Util::TickProfile::FORWARD_PASSES) <= 20);
+  }
+
+  SECTION("Ants that run out of energy are respawned with one life fewer") {
+    world.update(0.0f);
+    auto& ants = population.get_ants();
+    ants[3].set_energy(1e-6f);
+    const int lives = ants[3].get_remaining_lives();
+
+    world.update(0.5f);
+    REQUIRE(population.get_ants().size() == 20);
+    REQUIRE_FALSE(population.get_ants()[3].is_dead());
+    REQUIRE(population.get_ants()[3].get_remaining_lives() == lives - 1);
+  }
+
+  SECTION("Ants on their last life are replaced and their genome kept") {
+    world.update(0.0f);
+    auto& ants = population.get_ants();
+    ants[5].set_remaining_lives(0);
+    ants[5].set_energy(1e-6f);
+    const size_t genomes = population.get_fitness_data().get_seen();
+
+    world.update(0.5f);
+    REQUIRE(population.get_ants().size() == 20);
+    REQUIRE_FALSE(population.get_ants()[5].is_dead());
+    REQUIRE(population.get_ants()[5].get_remaining_lives() == Ant::ANT_LIVES);
+    REQUIRE(population.get_fitness_data().get_seen() == genomes + 1);
+    REQUIRE(world.get_tick_profile().get_count(Util::TickProfile::BIRTHS) == 1);
+  }
+}
@@ -0,0 +1,54 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "../food/food_test_helper.hpp"
+#include "util/allocation_counter.hpp"
+#include "world.hpp"
+
+namespace {
+constexpr int WARM_UP_TICKS = 300;
+constexpr int CHECKED_TICKS = 300;
+constexpr float TIME_DELTA = 0.1f;
+// A birth copies and breeds genomes and builds a brain: about 440 allocations and 100 KiB
+constexpr uint64_t ALLOCATIONS_PER_BIRTH = 512;
+constexpr uint64_t BYTES_PER_BIRTH = 128 * 1024;
+}  // namespace
+
+// Once its buffers have grown to their working size a tick should only allocate for the ants
+// born in it, whose genomes and brains are new, and no more per birth than the budget above.
+// Fails when anything else starts allocating or births grow more expensive
+TEST_CASE("Steady-state ticks only allocate for births", "[world][allocations]") {
+  MockTextureCache textureCache;
+  World world(textureCache);
+  world.get_population().set_size(60);
+  world.get_resources().set_food_count(40);
+  Util::TickProfile& profile = world.get_tick_profile();
+  profile.set_exclusive(true);
+
+  for (int tick = 0; tick < WARM_UP_TICKS; ++tick) {
+    world.update(TIME_DELTA);
+  }
+
+  int quietTicks = 0;
+  for (int tick = 0; tick < CHECKED_TICKS; ++tick) {
+    const auto before = Util::AllocationCounter::get();
+    world.update(TIME_DELTA);
+    const auto made = Util::AllocationCounter::get() - before;
+
+    for (size_t phase = 0; phase < Util::TickProfile::PHASE_COUNT; ++phase) {
+      const auto name = static_cast<Util::TickProfile::Phase>(phase);
+      if (name != Util::TickProfile::RETIRE_BREED) {
+        INFO("Phase " << Util::TickProfile::name(name) << " on tick " << tick);
+        REQUIRE(profile.get_allocations(name).allocations == 0);
+      }
+    }
+    const uint64_t births = profile.get_count(Util::TickProfile::BIRTHS);
+    const auto breeding = profile.get_allocations(Util::TickProfile::RETIRE_BREED);
+    INFO(births << " births on tick " << tick);
+    REQUIRE(breeding.allocations <= births * ALLOCATIONS_PER_BIRTH);
+    REQUIRE(breeding.bytes <= births * BYTES_PER_BIRTH);
+    // Nothing between the phases allocates either
+    REQUIRE(made.allocations == breeding.allocations);
+    quietTicks += births == 0 ? 1 : 0;
+  }
+  REQUIRE(quietTicks > 0);
+}